@@ -0,0 +1,31 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+// Return the value of a monotonic clock in nanoseconds
+static inline uint64_t bench_now(void) {
+  struct timespec time;
+  clock_gettime(CLOCK_MONOTONIC, &time);
+  return (uint64_t) time.tv_sec * 1000000000 + (uint64_t) time.tv_nsec;
+}
+
+// Return the next number in a xorshift64 sequence at state
+static inline uint64_t bench_random(uint64_t *state) {
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+// Print a line of the report with the name of the case and its measurements
+#define bench_report(name, format, ...) \
+  printf("%-32s " format "\n", (name), __VA_ARGS__)
+
+// Prevent the compiler from optimizing away the computation of value
+#define bench_use(value) __asm__ volatile("" : : "r"(value) : "memory")
+
+#endif /* BENCH_H */
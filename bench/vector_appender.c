@@ -0,0 +1,70 @@
+// An append of a stream of 32-bit tokens, one at a time, with vector_append()
+// and with vector_appender_push()
+//
+// Usage: bench_vector_appender [number of tokens]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static void measure_append(const uint32_t *tokens, size_t count) {
+  vector_on(uint32_t) vector = vector_create();
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; vector != NULL && i < count; i++)
+    vector = vector_append(vector, &tokens[i]);
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror("vector_append");
+    exit(EXIT_FAILURE);
+  }
+  bench_use(vector);
+  bench_report("vector_append", "%8.2f ms %8.2f ns/token",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+static void measure_appender(const uint32_t *tokens, size_t count) {
+  vector_on(uint32_t) vector = vector_create();
+  struct vector_appender appender;
+
+  uint64_t start = bench_now();
+  if (vector_appender_begin(&appender, vector) == -1) {
+    perror("vector_appender_begin");
+    exit(EXIT_FAILURE);
+  }
+  for (size_t i = 0; i < count; i++)
+    if (vector_appender_push(&appender, &tokens[i]) == -1) {
+      perror("vector_appender_push");
+      exit(EXIT_FAILURE);
+    }
+  vector = vector_appender_commit(&appender);
+  uint64_t time = bench_now() - start;
+
+  bench_use(vector);
+  bench_report("vector_appender_push", "%8.2f ms %8.2f ns/token",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+int main(int argc, char *argv[]) {
+  size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 24;
+
+  uint32_t *tokens = malloc(count * sizeof(*tokens));
+  if (count == 0 || tokens == NULL)
+    return EXIT_FAILURE;
+
+  uint64_t state = 1;
+  for (size_t i = 0; i < count; i++)
+    tokens[i] = (uint32_t) bench_random(&state);
+
+  measure_append(tokens, count);
+  measure_appender(tokens, count);
+
+  free(tokens);
+}
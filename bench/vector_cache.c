@@ -0,0 +1,63 @@
+// Churn of short-lived vectors of random lengths, each built by appends and
+// deleted soon after, with the cache of the thread disabled and enabled
+//
+// Usage: bench_vector_cache [number of vectors] [maximum length of a vector]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+// The number of vectors that are alive at once
+#define LIVE 64
+
+static void measure(const char *name, size_t ceiling,
+    size_t count, size_t length) {
+  vector_on(uint64_t) live[LIVE] = { 0 };
+  uint64_t state = 88172645463325252u;
+
+  if (ceiling != 0)
+    vector_cache_enable(ceiling);
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    size_t slot = bench_random(&state) % LIVE;
+    size_t n = bench_random(&state) % (length + 1);
+
+    if (live[slot] != NULL)
+      vector_delete(live[slot]);
+    live[slot] = vector_create();
+    for (size_t j = 0; j < n; j++)
+      live[slot] = vector_append(live[slot], &(uint64_t) { j });
+
+    if (live[slot] == NULL) {
+      perror(name);
+      exit(EXIT_FAILURE);
+    }
+    bench_use(live[slot]);
+  }
+  uint64_t time = bench_now() - start;
+
+  const struct vector_cache *cache = vector_cache();
+  size_t total = cache->hits + cache->misses;
+  bench_report(name, "%8.2f ms %8.2f ns/vector %6.1f%% hits",
+      time / 1e6, (double) time / count,
+      total != 0 ? 100.0 * cache->hits / total : 0.0);
+
+  for (size_t i = 0; i < LIVE; i++)
+    if (live[i] != NULL)
+      vector_delete(live[i]);
+  vector_cache_disable();
+}
+
+int main(int argc, char *argv[]) {
+  size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 20;
+  size_t length = argc > 2 ? strtoull(argv[2], NULL, 10) : 64;
+
+  measure("disabled", 0, count, length);
+  measure("enabled (64 KiB)", 64 << 10, count, length);
+  measure("enabled (1 MiB)", 1 << 20, count, length);
+}
@@ -0,0 +1,58 @@
+// A scratch vector that's emptied and refilled to the same length on each of
+// many rounds, with vector_truncate(), with vector_truncate() on a vector that
+// keeps its volume by vector_policy_keep(), and with vector_clear()
+//
+// Usage: bench_vector_clear [length of the vector] [number of rounds]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+enum empty { TRUNCATE, KEEP, CLEAR };
+
+static void measure(const char *name, enum empty empty, size_t length,
+    size_t rounds) {
+  vector_on(uint64_t) vector = vector_create_with(uint64_t, length);
+  if (vector != NULL && empty == KEEP)
+    vector = vector_policy_keep(vector, 1);
+  if (vector == NULL) {
+    perror(name);
+    exit(EXIT_FAILURE);
+  }
+
+  uint64_t start = bench_now();
+  for (size_t round = 0; vector != NULL && round < rounds; round++) {
+    for (size_t i = 0; vector != NULL && i < length; i++)
+      vector = vector_append(vector, &(uint64_t) { i ^ round });
+    bench_use(vector);
+    if (vector != NULL && empty == CLEAR)
+      vector = vector_clear(vector);
+    else if (vector != NULL)
+      vector = vector_truncate(vector, 0);
+  }
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror(name);
+    exit(EXIT_FAILURE);
+  }
+  bench_report(name, "%8.2f ms %8.2f us/round",
+      time / 1e6, (double) time / rounds / 1e3);
+  vector_delete(vector);
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 16;
+  size_t rounds = argc > 2 ? strtoull(argv[2], NULL, 10) : 1 << 10;
+
+  if (length == 0 || rounds == 0)
+    return EXIT_FAILURE;
+
+  measure("vector_truncate", TRUNCATE, length, rounds);
+  measure("vector_truncate + keep", KEEP, length, rounds);
+  measure("vector_clear", CLEAR, length, rounds);
+}
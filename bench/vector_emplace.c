@@ -0,0 +1,76 @@
+// An append of 200-byte records that are each built from a counter, with each
+// record built on the stack and copied in by vector_append() and with each
+// built in place by vector_emplace_back()
+//
+// Usage: bench_vector_emplace [number of records]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+struct record {
+  uint64_t id;
+  uint64_t fields[24];
+};
+
+static void fill(struct record *record, uint64_t id) {
+  record->id = id;
+  for (size_t i = 0; i < sizeof(record->fields) / sizeof(uint64_t); i++)
+    record->fields[i] = id ^ i;
+}
+
+static void measure_append(size_t count) {
+  vector_on(struct record) vector = vector_create();
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; vector != NULL && i < count; i++) {
+    struct record record;
+    fill(&record, i);
+    bench_use(&record);
+    vector = vector_append(vector, &record);
+  }
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror("vector_append");
+    exit(EXIT_FAILURE);
+  }
+  bench_use(vector);
+  bench_report("vector_append", "%8.2f ms %8.2f ns/record",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+static void measure_emplace_back(size_t count) {
+  vector_on(struct record) vector = vector_create();
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    struct record *record = vector_emplace_back(&vector, 1);
+    if (record == NULL) {
+      perror("vector_emplace_back");
+      exit(EXIT_FAILURE);
+    }
+    fill(record, i);
+  }
+  uint64_t time = bench_now() - start;
+
+  bench_use(vector);
+  bench_report("vector_emplace_back", "%8.2f ms %8.2f ns/record",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+int main(int argc, char *argv[]) {
+  size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 20;
+
+  if (count == 0)
+    return EXIT_FAILURE;
+
+  measure_append(count);
+  measure_emplace_back(count);
+}
@@ -0,0 +1,87 @@
+// Warm-up of a large vector by rebuilding it with appends, and by reopening it
+// from a file with vector_file_open(), each followed by a pass over it, and the
+// cost of a copy of the vector by vector_import() against an attachment to it
+// by vector_file_attach()
+//
+// Usage: bench_vector_file [length of the vector] [path of the file]
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <vector.h>
+#include "bench.h"
+
+// Return the sum of the elements of the vector
+static uint64_t sum(vector_on(const uint64_t) vector) {
+  uint64_t total = 0;
+  for (size_t i = 0; i < vector_length(vector); i++)
+    total += vector[i];
+  return total;
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 24;
+  const char *path = argc > 2 ? argv[2] : "bench_vector_file.bin";
+  struct vector_file file;
+  uint64_t start, time;
+
+  unlink(path);
+
+  start = bench_now();
+  vector_on(uint64_t) vector = vector_create();
+  for (size_t i = 0; i < length; i++)
+    vector = vector_append(vector, &(uint64_t) { i });
+  time = bench_now() - start;
+  bench_use(sum(vector));
+  bench_report("rebuild", "%10.2f ms", time / 1e6);
+
+  vector_on(uint64_t) stored = vector_file_open(&file, path, uint64_t);
+  if (stored == NULL || (stored = vector_extend(stored, vector, length)) == NULL
+      || vector_file_sync(stored) != 0) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  vector_delete(stored);
+  vector_delete(vector);
+
+  start = bench_now();
+  if ((vector = vector_file_open(&file, path, uint64_t)) == NULL) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  time = bench_now() - start;
+  bench_report("reopen", "%10.2f ms", time / 1e6);
+
+  start = bench_now();
+  bench_use(sum(vector));
+  time = bench_now() - start;
+  bench_report("reopen (first pass)", "%10.2f ms", time / 1e6);
+
+  start = bench_now();
+  vector_on(uint64_t) copy = vector_import(vector, vector_length(vector));
+  time = bench_now() - start;
+  bench_report("copy", "%10.2f ms", time / 1e6);
+  vector_delete(copy);
+
+  struct vector_file reader;
+  int fd = open(path, O_RDONLY | O_CLOEXEC);
+  start = bench_now();
+  vector_on(const uint64_t) attached =
+    vector_file_attach(&reader, fd, uint64_t);
+  time = bench_now() - start;
+  if (attached == NULL) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  bench_use(sum(attached));
+  bench_report("attach", "%10.2f ms", time / 1e6);
+  vector_file_detach(attached);
+  close(fd);
+
+  vector_delete(vector);
+  unlink(path);
+}
@@ -0,0 +1,75 @@
+// Insertions at a cursor that advances through the middle of a vector, as in
+// typing into a text, with vector_insert() and through a gap buffer
+//
+// Usage: bench_vector_gap [initial length] [number of insertions]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static vector_on(char) build(size_t length) {
+  vector_on(char) vector = vector_create_with(char, length);
+  for (size_t i = 0; vector != NULL && i < length; i++)
+    vector = vector_append(vector, &(char) { 'a' + i % 26 });
+  return vector;
+}
+
+static void measure_insert(size_t length, size_t count) {
+  vector_on(char) vector = build(length);
+  size_t cursor = length / 2;
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; vector != NULL && i < count; i++)
+    vector = vector_insert(vector, cursor++, &(char) { 'x' });
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror("vector_insert");
+    exit(EXIT_FAILURE);
+  }
+  bench_use(vector);
+  bench_report("vector_insert", "%8.2f ms %8.2f ns/insertion",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+static void measure_gap(size_t length, size_t count) {
+  vector_on(char) vector = build(length);
+  struct vector_gap gap;
+  size_t cursor = length / 2;
+
+  if (vector == NULL || vector_gap_begin(&gap, vector) != 0) {
+    perror("vector_gap_begin");
+    exit(EXIT_FAILURE);
+  }
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    if (vector_gap_insert(&gap, cursor++, &(char) { 'x' }) != 0) {
+      perror("vector_gap_insert");
+      exit(EXIT_FAILURE);
+    }
+  }
+  vector = vector_gap_materialize(&gap);
+  uint64_t time = bench_now() - start;
+
+  bench_use(vector);
+  bench_report("vector_gap_insert", "%8.2f ms %8.2f ns/insertion",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 20;
+  size_t count = argc > 2 ? strtoull(argv[2], NULL, 10) : 1 << 16;
+
+  if (count == 0)
+    return EXIT_FAILURE;
+
+  measure_insert(length, count);
+  measure_gap(length, count);
+}
@@ -0,0 +1,90 @@
+// A merge of a sorted batch of elements into a sorted vector, each at its own
+// position, with a vector_insert() of each element and with one
+// vector_inject_many()
+//
+// Usage: bench_vector_inject [length of the vector] [number of elements]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static vector_on(uint64_t) build(size_t length) {
+  vector_on(uint64_t) vector = vector_create_with(uint64_t, length);
+  for (size_t i = 0; vector != NULL && i < length; i++)
+    vector = vector_append(vector, &(uint64_t) { i * 2 });
+  if (vector == NULL) {
+    perror("vector_append");
+    exit(EXIT_FAILURE);
+  }
+  return vector;
+}
+
+static void measure_insert(const size_t *positions, const uint64_t *batch,
+    size_t length, size_t count) {
+  vector_on(uint64_t) vector = build(length);
+
+  // each position is offset by the elements inserted before it
+  uint64_t start = bench_now();
+  for (size_t i = 0; vector != NULL && i < count; i++)
+    vector = vector_insert(vector, positions[i] + i, &batch[i]);
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror("vector_insert");
+    exit(EXIT_FAILURE);
+  }
+  bench_use(vector);
+  bench_report("vector_insert", "%8.2f ms %8.2f ns/element",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+static void measure_inject_many(const size_t *positions,
+    const uint64_t *batch, size_t length, size_t count) {
+  vector_on(uint64_t) vector = build(length);
+
+  uint64_t start = bench_now();
+  vector = vector_inject_many(vector, positions, batch, count);
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror("vector_inject_many");
+    exit(EXIT_FAILURE);
+  }
+  bench_use(vector);
+  bench_report("vector_inject_many", "%8.2f ms %8.2f ns/element",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+static int compare(const void *a, const void *b) {
+  size_t x = *(const size_t *) a, y = *(const size_t *) b;
+  return (x > y) - (x < y);
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 20;
+  size_t count = argc > 2 ? strtoull(argv[2], NULL, 10) : 1 << 12;
+
+  size_t *positions = malloc(count * sizeof(*positions));
+  uint64_t *batch = malloc(count * sizeof(*batch));
+  if (count == 0 || positions == NULL || batch == NULL)
+    return EXIT_FAILURE;
+
+  uint64_t state = 1;
+  for (size_t i = 0; i < count; i++)
+    positions[i] = bench_random(&state) % (length + 1);
+  qsort(positions, count, sizeof(*positions), compare);
+  for (size_t i = 0; i < count; i++)
+    batch[i] = positions[i] * 2 - 1;
+
+  measure_insert(positions, batch, length, count);
+  measure_inject_many(positions, batch, length, count);
+
+  free(positions);
+  free(batch);
+}
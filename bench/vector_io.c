@@ -0,0 +1,63 @@
+// Throughput of vector_write_fd() and vector_read_fd() through a file, and of
+// the checksum that both of them compute over the data
+//
+// Usage: bench_vector_io [length of the vector] [path of the file]
+
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <vector.h>
+#include "bench.h"
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 25;
+  const char *path = argc > 2 ? argv[2] : "bench_vector_io.bin";
+  uint64_t state = 88172645463325252u;
+  uint64_t start, time;
+  int fd;
+
+  vector_on(uint64_t) vector = vector_create_with(uint64_t, length);
+  for (size_t i = 0; i < length; i++)
+    vector = vector_append(vector, &(uint64_t) { bench_random(&state) });
+  double mib = length * sizeof(uint64_t) / 1048576.0;
+
+  start = bench_now();
+  bench_use(__vector_io_checksum(vector, length * sizeof(uint64_t)));
+  time = bench_now() - start;
+  bench_report("checksum", "%8.2f ms %8.1f MiB/s",
+      time / 1e6, mib / (time / 1e9));
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0666)) < 0) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+
+  start = bench_now();
+  if (vector_write_fd(vector, fd) != 0) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  time = bench_now() - start;
+  bench_report("write", "%8.2f ms %8.1f MiB/s",
+      time / 1e6, mib / (time / 1e9));
+
+  lseek(fd, 0, SEEK_SET);
+  start = bench_now();
+  vector_on(uint64_t) read = vector_read_fd(uint64_t, fd);
+  if (read == NULL) {
+    perror(path);
+    return EXIT_FAILURE;
+  }
+  time = bench_now() - start;
+  bench_report("read", "%8.2f ms %8.1f MiB/s",
+      time / 1e6, mib / (time / 1e9));
+
+  vector_delete(read);
+  vector_delete(vector);
+  close(fd);
+  unlink(path);
+}
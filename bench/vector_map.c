@@ -0,0 +1,50 @@
+// Random vector_at() throughput in a large vector with and without huge pages
+//
+// Usage: bench_vector_map [size in MiB] [number of accesses]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static void measure(const char *name, const struct vector_allocator *allocator,
+    size_t length, size_t count) {
+  vector_on(uint64_t) vector = vector_create_in(allocator);
+  uint64_t state = 88172645463325252u;
+  uint64_t sum = 0;
+
+  if ((vector = vector_resize(vector, length)) == NULL) {
+    perror(name);
+    exit(EXIT_FAILURE);
+  }
+
+  for (size_t i = 0; i < length; i++)
+    vector = vector_append(vector, &(uint64_t) { i });
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    size_t j = bench_random(&state) % vector_length(vector);
+    sum += *(uint64_t *) vector_at(vector, j, sizeof(uint64_t));
+  }
+  uint64_t time = bench_now() - start;
+  bench_use(sum);
+
+  bench_report(name, "%8.2f ns/access %8.2f Maccess/s",
+      (double) time / count, count * 1e3 / time);
+
+  vector_delete(vector);
+}
+
+int main(int argc, char *argv[]) {
+  size_t size = argc > 1 ? strtoull(argv[1], NULL, 10) : 1024;
+  size_t count = argc > 2 ? strtoull(argv[2], NULL, 10) : 50000000;
+  size_t length = (size << 20) / sizeof(uint64_t);
+  struct vector_map map;
+
+  measure("malloc", NULL, length, count);
+  measure("vector_map_init", vector_map_init(&map, 1 << 20), length, count);
+  measure("vector_map_init_huge",
+      vector_map_init_huge(&map, 1 << 20), length, count);
+}
@@ -0,0 +1,106 @@
+// Reallocations, peak volume, and peak RSS of growth by appends under each of
+// several growth policies
+//
+// Usage: bench_vector_policy [number of vectors] [length of each vector]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static size_t reallocations = 0;
+
+static void *count_allocate(size_t size, void *data) {
+  (void) data;
+  return malloc(size);
+}
+
+static void *count_reallocate(void *object, size_t size, void *data) {
+  (void) data;
+  reallocations++;
+  return realloc(object, size);
+}
+
+static void count_deallocate(void *object, void *data) {
+  (void) data;
+  free(object);
+}
+
+static const struct vector_allocator allocator = {
+  .allocate = count_allocate,
+  .reallocate = count_reallocate,
+  .deallocate = count_deallocate,
+};
+
+// Build count vectors of length elements with the policy in a child process so
+// that each policy is measured with its own peak RSS
+static void measure(const char *name, const struct vector_policy *policy,
+    size_t count, size_t length) {
+  pid_t pid;
+
+  fflush(stdout);
+  if ((pid = fork()) < 0) {
+    perror(name);
+    exit(EXIT_FAILURE);
+  } else if (pid != 0) {
+    waitpid(pid, NULL, 0);
+    return;
+  }
+
+  vector_on(vector_on(uint64_t)) vectors = vector_create();
+  size_t volume = 0;
+
+  vector_policy_set(policy);
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    vector_on(uint64_t) vector = vector_create_in(&allocator);
+    for (size_t j = 0; j < length; j++)
+      vector = vector_append(vector, &(uint64_t) { j });
+    volume += vector_volume(vector);
+    vectors = vector_append(vectors, &vector);
+  }
+  uint64_t time = bench_now() - start;
+
+  struct rusage usage;
+  getrusage(RUSAGE_SELF, &usage);
+
+  bench_report(name, "%8.2f ms %10zu reallocs %8.1f MiB volume %8.1f MiB RSS",
+      time / 1e6, reallocations,
+      volume * sizeof(uint64_t) / 1048576.0, usage.ru_maxrss / 1024.0);
+
+  for (size_t i = 0; i < vector_length(vectors); i++)
+    vector_delete(vectors[i]);
+  vector_delete(vectors);
+  exit(EXIT_SUCCESS);
+}
+
+int main(int argc, char *argv[]) {
+  size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 64;
+  size_t length = argc > 2 ? strtoull(argv[2], NULL, 10) : 1 << 20;
+
+  static const struct vector_policy doubling = {
+    .growth_numerator = 2, .growth_denominator = 1,
+    .shrink_divisor = 4, .shrink_numerator = 2, .shrink_denominator = 1,
+  };
+  static const struct vector_policy compact = {
+    .growth_numerator = 5, .growth_denominator = 4,
+    .shrink_divisor = 2, .shrink_numerator = 9, .shrink_denominator = 8,
+  };
+  static const struct vector_policy pages = {
+    .growth_numerator = 3, .growth_denominator = 2,
+    .step = 4096, .round = 4096,
+    .shrink_divisor = 2, .shrink_numerator = 5, .shrink_denominator = 4,
+  };
+
+  measure("default (8/5)", NULL, count, length);
+  measure("doubling (2)", &doubling, count, length);
+  measure("compact (5/4)", &compact, count, length);
+  measure("pages (3/2, 4 KiB)", &pages, count, length);
+}
@@ -0,0 +1,84 @@
+// A removal of the elements of a vector that a predicate is true of, with a
+// vector_remove() of each element, with one vector_remove_if(), and with a
+// vector_remove_unordered() of each element where the order isn't retained
+//
+// Usage: bench_vector_remove [length of the vector] [one in how many elements
+//   to remove]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static _Bool marked(const void *elmt, void *data) {
+  return *(const uint64_t *) elmt % *(const size_t *) data == 0;
+}
+
+static vector_on(uint64_t) build(size_t length) {
+  vector_on(uint64_t) vector = vector_create_with(uint64_t, length);
+  uint64_t state = 1;
+  for (size_t i = 0; vector != NULL && i < length; i++)
+    vector = vector_append(vector, &(uint64_t) { bench_random(&state) });
+  if (vector == NULL) {
+    perror("vector_append");
+    exit(EXIT_FAILURE);
+  }
+  return vector;
+}
+
+static void measure_remove(
+    const char *name, _Bool unordered, size_t length, size_t every) {
+  vector_on(uint64_t) vector = build(length);
+
+  // from the tail, so each element that fills a removal is already tested
+  uint64_t start = bench_now();
+  for (size_t i = vector_length(vector); vector != NULL && i-- > 0; ) {
+    if (!marked(&vector[i], &every))
+      continue;
+    vector = unordered
+      ? vector_remove_unordered(vector, i)
+      : vector_remove(vector, i);
+  }
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror(name);
+    exit(EXIT_FAILURE);
+  }
+  bench_use(vector);
+  bench_report(name, "%8.2f ms %8.2f ns/element",
+      time / 1e6, (double) time / length);
+  vector_delete(vector);
+}
+
+static void measure_remove_if(size_t length, size_t every) {
+  vector_on(uint64_t) vector = build(length);
+
+  uint64_t start = bench_now();
+  vector = vector_remove_if(vector, marked, &every);
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror("vector_remove_if");
+    exit(EXIT_FAILURE);
+  }
+  bench_use(vector);
+  bench_report("vector_remove_if", "%8.2f ms %8.2f ns/element",
+      time / 1e6, (double) time / length);
+  vector_delete(vector);
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 18;
+  size_t every = argc > 2 ? strtoull(argv[2], NULL, 10) : 4;
+
+  if (length == 0 || every == 0)
+    return EXIT_FAILURE;
+
+  measure_remove("vector_remove", 0, length, every);
+  measure_remove_if(length, every);
+  measure_remove("vector_remove_unordered", 1, length, every);
+}
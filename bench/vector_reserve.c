@@ -0,0 +1,61 @@
+// Bulk builds of vectors with a known final length by appends alone, and with
+// vector_create_with() or vector_reserve() ahead of the appends
+//
+// Usage: bench_vector_reserve [number of vectors] [length of each vector]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+enum method { APPEND, CREATE_WITH, RESERVE };
+
+static void measure(const char *name, enum method method,
+    size_t count, size_t length) {
+  vector_on(vector_on(uint64_t)) vectors =
+    vector_create_with(vector_on(uint64_t), count);
+  size_t volume = 0;
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    vector_on(uint64_t) vector;
+
+    if (method == CREATE_WITH)
+      vector = vector_create_with(uint64_t, length);
+    else
+      vector = vector_create();
+    if (method == RESERVE)
+      vector = vector_reserve(vector, length);
+
+    for (size_t j = 0; j < length; j++)
+      vector = vector_append(vector, &(uint64_t) { j });
+
+    if (vector == NULL) {
+      perror(name);
+      exit(EXIT_FAILURE);
+    }
+    volume += vector_volume(vector);
+    vectors = vector_append(vectors, &vector);
+  }
+  uint64_t time = bench_now() - start;
+
+  bench_report(name, "%8.2f ms %8.2f ns/element %8.1f MiB volume",
+      time / 1e6, (double) time / (count * length),
+      volume * sizeof(uint64_t) / 1048576.0);
+
+  for (size_t i = 0; i < vector_length(vectors); i++)
+    vector_delete(vectors[i]);
+  vector_delete(vectors);
+}
+
+int main(int argc, char *argv[]) {
+  size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 100000;
+  size_t length = argc > 2 ? strtoull(argv[2], NULL, 10) : 100;
+
+  measure("vector_append", APPEND, count, length);
+  measure("vector_create_with", CREATE_WITH, count, length);
+  measure("vector_reserve", RESERVE, count, length);
+}
@@ -0,0 +1,104 @@
+// A queue of a steady length that's pushed to at one end and removed from at
+// the other, with vector_push() and vector_shift(), with vector_unshift() and
+// vector_pull(), and with each through a ring buffer
+//
+// Usage: bench_vector_ring [length of the queue] [number of operations]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static vector_on(uint64_t) build(size_t length) {
+  vector_on(uint64_t) vector = vector_create_with(uint64_t, length);
+  for (size_t i = 0; vector != NULL && i < length; i++)
+    vector = vector_push(vector, &(uint64_t) { i });
+  if (vector == NULL) {
+    perror("vector_push");
+    exit(EXIT_FAILURE);
+  }
+  return vector;
+}
+
+static void measure_vector(
+    const char *name, _Bool reverse, size_t length, size_t count) {
+  vector_on(uint64_t) vector = build(length);
+  uint64_t sum = 0;
+  uint64_t elmt = 0;
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; vector != NULL && i < count; i++) {
+    if (reverse) {
+      vector = vector_unshift(vector, &(uint64_t) { i });
+      if (vector != NULL)
+        vector = vector_pull(vector, &elmt);
+    } else {
+      vector = vector_push(vector, &(uint64_t) { i });
+      if (vector != NULL)
+        vector = vector_shift(vector, &elmt);
+    }
+    sum += elmt;
+  }
+  uint64_t time = bench_now() - start;
+
+  if (vector == NULL) {
+    perror(name);
+    exit(EXIT_FAILURE);
+  }
+  bench_use(sum);
+  bench_report(name, "%8.2f ms %8.2f ns/operation",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+static void measure_ring(
+    const char *name, _Bool reverse, size_t length, size_t count) {
+  vector_on(uint64_t) vector = build(length);
+  struct vector_ring ring;
+  uint64_t sum = 0;
+  uint64_t elmt;
+
+  if (vector_ring_begin(&ring, vector) != 0) {
+    perror("vector_ring_begin");
+    exit(EXIT_FAILURE);
+  }
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    int result = reverse
+      ? vector_ring_unshift(&ring, &(uint64_t) { i })
+      : vector_ring_push(&ring, &(uint64_t) { i });
+    if (result != 0) {
+      perror(name);
+      exit(EXIT_FAILURE);
+    }
+    if (reverse)
+      vector_ring_pull(&ring, &elmt);
+    else
+      vector_ring_shift(&ring, &elmt);
+    sum += elmt;
+  }
+  vector = vector_ring_linearize(&ring);
+  uint64_t time = bench_now() - start;
+
+  bench_use(sum);
+  bench_report(name, "%8.2f ms %8.2f ns/operation",
+      time / 1e6, (double) time / count);
+  vector_delete(vector);
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 14;
+  size_t count = argc > 2 ? strtoull(argv[2], NULL, 10) : 1 << 18;
+
+  if (count == 0)
+    return EXIT_FAILURE;
+
+  measure_vector("vector_shift", 0, length, count);
+  measure_ring("vector_ring_shift", 0, length, count);
+  measure_vector("vector_pull", 1, length, count);
+  measure_ring("vector_ring_pull", 1, length, count);
+}
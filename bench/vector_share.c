@@ -0,0 +1,60 @@
+// Snapshots of a vector that are taken per request, read, and deleted, either
+// duplicated or shared, with a modification of one in every so many of them
+//
+// Usage: bench_vector_share [number of snapshots] [length of the vector]
+//   [snapshots per modification]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static void measure(const char *name, _Bool share,
+    uint64_t *config, size_t count, size_t every) {
+  uint64_t sum = 0;
+
+  uint64_t start = bench_now();
+  for (size_t i = 0; i < count; i++) {
+    vector_on(uint64_t) snapshot = share
+      ? vector_share(config)
+      : vector_duplicate(config);
+
+    if (snapshot != NULL && every != 0 && i % every == 0) {
+      snapshot = vector_unshare(snapshot);
+      if (snapshot != NULL)
+        snapshot[0] = i;
+    }
+    if (snapshot == NULL) {
+      perror(name);
+      exit(EXIT_FAILURE);
+    }
+
+    sum += snapshot[i % vector_length(snapshot)];
+    vector_delete(snapshot);
+  }
+  uint64_t time = bench_now() - start;
+
+  bench_use(sum);
+  bench_report(name, "%8.2f ms %8.2f ns/snapshot",
+      time / 1e6, (double) time / count);
+}
+
+int main(int argc, char *argv[]) {
+  size_t count = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 20;
+  size_t length = argc > 2 ? strtoull(argv[2], NULL, 10) : 1024;
+  size_t every = argc > 3 ? strtoull(argv[3], NULL, 10) : 100;
+
+  vector_on(uint64_t) config = vector_create_with(uint64_t, length);
+  for (size_t i = 0; i < length; i++)
+    config = vector_append(config, &(uint64_t) { i });
+  if (config == NULL || length == 0)
+    return EXIT_FAILURE;
+
+  measure("duplicate", 0, config, count, every);
+  measure("share", 1, config, count, every);
+
+  vector_delete(config);
+}
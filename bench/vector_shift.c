@@ -0,0 +1,83 @@
+// A queue of a steady length that's appended to at its tail and taken from its
+// head, with elements of 4, 8, 12, and 16 bytes that are each taken by
+// vector_remove(), which moves the rest on each take, and by vector_shift(),
+// which advances the start of the vector through headroom
+//
+// Usage: bench_vector_shift [length of the queue] [number of operations]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "bench.h"
+
+// An element that's a fraction of the alignment of a vector
+struct quarter {
+  uint32_t key;
+};
+
+// An element that's half the alignment of a vector
+struct half {
+  uint64_t key;
+};
+
+// An element that isn't a divisor of the alignment of a vector
+struct odd {
+  uint32_t key;
+  uint32_t rest[2];
+};
+
+// An element that's the alignment of a vector
+struct whole {
+  _Alignas(max_align_t) uint64_t key;
+};
+
+#define take_remove(vector, elmt) \
+  ((elmt) = (vector)[0], vector_remove((vector), 0))
+#define take_shift(vector, elmt) vector_shift((vector), &(elmt))
+
+#define measure(type, take, name, length, count) do { \
+  vector_on(type) vector = vector_create(); \
+  uint64_t sum = 0; \
+  type elmt; \
+  \
+  for (size_t i = 0; vector != NULL && i < (length); i++) \
+    vector = vector_append(vector, &(type) { .key = i }); \
+  \
+  uint64_t start = bench_now(); \
+  for (size_t i = 0; vector != NULL && i < (count); i++) { \
+    vector = vector_append(vector, &(type) { .key = i }); \
+    if (vector != NULL) \
+      vector = take(vector, elmt); \
+    sum += elmt.key; \
+  } \
+  uint64_t time = bench_now() - start; \
+  \
+  if (vector == NULL) { \
+    perror(name); \
+    exit(EXIT_FAILURE); \
+  } \
+  bench_use(sum); \
+  bench_report(name, "%8.2f ms %8.2f ns/operation", \
+      time / 1e6, (double) time / (count)); \
+  vector_delete(vector); \
+} while (0)
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 14;
+  size_t count = argc > 2 ? strtoull(argv[2], NULL, 10) : 1 << 18;
+
+  if (count == 0)
+    return EXIT_FAILURE;
+
+  measure(struct quarter, take_remove, "remove 4 bytes", length, count);
+  measure(struct quarter, take_shift, "shift 4 bytes", length, count);
+  measure(struct half, take_remove, "remove 8 bytes", length, count);
+  measure(struct half, take_shift, "shift 8 bytes", length, count);
+  measure(struct odd, take_remove, "remove 12 bytes", length, count);
+  measure(struct odd, take_shift, "shift 12 bytes", length, count);
+  measure(struct whole, take_remove, "remove 16 bytes", length, count);
+  measure(struct whole, take_shift, "shift 16 bytes", length, count);
+}
@@ -0,0 +1,59 @@
+// Allocation of a vector of zeroed counters that's then sparsely incremented,
+// either grown with vector_resize() and zeroed with memset() or grown with
+// vector_resize_zeroed(), then extended over the zeroed elements
+//
+// Usage: bench_vector_zeroed [number of counters] [number of increments]
+//   [number of repetitions]
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector.h>
+#include "bench.h"
+
+static void measure(const char *name, _Bool zeroed,
+    size_t length, size_t increments, size_t repetitions) {
+  uint64_t state = 88172645463325252u;
+  uint64_t sum = 0;
+
+  uint64_t start = bench_now();
+  for (size_t r = 0; r < repetitions; r++) {
+    vector_on(uint32_t) count = vector_create();
+
+    if (zeroed)
+      count = vector_resize_zeroed(count, length);
+    else if ((count = vector_resize(count, length)) != NULL)
+      memset(count, 0, length * sizeof(count[0]));
+    if (count != NULL)
+      count = vector_extend(count, NULL, length);
+    if (count == NULL) {
+      perror(name);
+      exit(EXIT_FAILURE);
+    }
+
+    for (size_t i = 0; i < increments; i++)
+      count[bench_random(&state) % length]++;
+    sum += count[r % length];
+    vector_delete(count);
+  }
+  uint64_t time = bench_now() - start;
+
+  bench_use(sum);
+  bench_report(name, "%8.2f ms %8.2f ms/vector",
+      time / 1e6, time / 1e6 / repetitions);
+}
+
+int main(int argc, char *argv[]) {
+  size_t length = argc > 1 ? strtoull(argv[1], NULL, 10) : 1 << 24;
+  size_t increments = argc > 2 ? strtoull(argv[2], NULL, 10) : 1 << 12;
+  size_t repetitions = argc > 3 ? strtoull(argv[3], NULL, 10) : 32;
+
+  if (length == 0 || repetitions == 0)
+    return EXIT_FAILURE;
+
+  measure("resize and memset", 0, length, increments, repetitions);
+  measure("resize zeroed", 1, length, increments, repetitions);
+}
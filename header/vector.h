@@ -30,15 +30,26 @@
 
 #include "vector/common.h"
 #include "vector/access.h"
+#include "vector/allocator.h"
+#include "vector/appender.h"
+#include "vector/arena.h"
+#include "vector/cache.h"
 #include "vector/comparison.h"
 #include "vector/create.h"
 #include "vector/debug.h"
 #include "vector/delete.h"
+#include "vector/file.h"
+#include "vector/gap.h"
 #include "vector/insert.h"
+#include "vector/io.h"
+#include "vector/map.h"
 #include "vector/move.h"
+#include "vector/policy.h"
 #include "vector/remove.h"
 #include "vector/resize.h"
+#include "vector/ring.h"
 #include "vector/search.h"
+#include "vector/share.h"
 #include "vector/shift.h"
 #include "vector/sort.h"
 
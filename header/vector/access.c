@@ -3,11 +3,13 @@
 #ifndef VECTOR_ACCESS_C
 #define VECTOR_ACCESS_C
 
+#include <assert.h>
 #include <stddef.h>
 #include <string.h>
 
 #include "common.h"
 #include "access.h"
+#include "share.h"
 
 __vector_inline__
 size_t vector_index(vector_c vector, const void *elmt, size_t z) {
@@ -26,6 +28,9 @@ void vector_get(vector_c vector, size_t i, void *elmt, size_t z) {
 
 __vector_inline__
 void vector_set(vector_t vector, size_t i, const void *elmt, size_t z) {
+  // the other references to a shared vector would see the element change
+  assert(!vector_shared(vector));
+
   // This comparison is well defined regardless of whether elmt is an object in
   // the vector
   if (elmt == vector_at(vector, i, z))
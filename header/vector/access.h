@@ -155,6 +155,9 @@ void vector_get(vector_c vector, size_t i, void *elmt, size_t z);
  * the object at @a elmt is incompatible with the element type of the vector,
  * then the behavior is undefined.
  *
+ * The @a vector mustn't be shared by vector_share(), which is asserted, as the
+ * other references to it would be modified (see vector_unshare()).
+ *
  * @param vector the vector to operate on
  * @param i the index of the element in the @a vector to copy to
  * @param elmt the location to copy the element from
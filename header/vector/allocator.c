@@ -0,0 +1,236 @@
+/// @file header/vector/allocator.c
+
+#ifndef VECTOR_ALLOCATOR_C
+#define VECTOR_ALLOCATOR_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif /* __GLIBC__ */
+
+#include "common.h"
+#include "allocator.h"
+#include "cache.h"
+
+__vector_inline__ void *__vector_allocate(
+    const struct vector_allocator *allocator, size_t size) {
+  if (allocator == NULL)
+    return malloc(size);
+  return allocator->allocate(size, allocator->data);
+}
+
+__vector_inline__ void *__vector_reallocate(
+    const struct vector_allocator *allocator, void *object, size_t size) {
+  if (allocator == NULL)
+    return realloc(object, size);
+  return allocator->reallocate(object, size, allocator->data);
+}
+
+__vector_inline__ size_t __vector_usable(
+    const struct vector_allocator *allocator, void *object, size_t size) {
+  if (allocator == NULL) {
+#ifdef __GLIBC__
+    return malloc_usable_size(object);
+#else
+    return size;
+#endif /* __GLIBC__ */
+  }
+  if (allocator->usable == NULL)
+    return size;
+  return allocator->usable(object, allocator->data);
+}
+
+__vector_inline__ void __vector_deallocate(
+    const struct vector_allocator *allocator, void *object) {
+  if (allocator == NULL)
+    free(object);
+  else
+    allocator->deallocate(object, allocator->data);
+}
+
+__vector_inline__ struct __vector_header_t *__vector_header_allocate(
+    const struct vector_allocator *allocator, size_t alignment, size_t size) {
+  struct __vector_header_t *header;
+  unsigned bucket = 0;
+  char *object;
+
+  // the allocation is already aligned to max_align_t, so just the remainder of
+  // the alignment is needed for the header to be offset within it
+  if (__builtin_add_overflow(size, alignment - _Alignof(max_align_t), &size))
+    return errno = ENOMEM, NULL;
+  if (allocator == NULL && alignment == _Alignof(max_align_t))
+    bucket = __vector_cache_bucket(size);
+  if (bucket != 0)
+    object = __vector_cache_take(bucket);
+  else
+    object = __vector_allocate(allocator, size);
+  if (object == NULL)
+    return NULL;
+
+  size_t offset = -((uintptr_t) object + sizeof(*header)) & (alignment - 1);
+  header = (struct __vector_header_t *) (object + offset);
+  header->allocator = allocator;
+  header->offset = offset;
+  header->alignment = alignment;
+  header->flags = 0;
+  header->bucket = (unsigned short) bucket;
+  header->shares = 0;
+  return header;
+}
+
+__vector_inline__ struct __vector_header_t *__vector_header_reallocate(
+    struct __vector_header_t *header, size_t skew, size_t size, size_t used) {
+  size_t alignment = header->alignment;
+  size_t offset = header->offset;
+  char *object = (char *) header - offset;
+
+  // a vector in storage that it doesn't own, or that other references retain
+  // as is, is moved to an allocation (the empty vector is compared for just
+  // the compiler to see that it's never passed to realloc() or free())
+  _Bool shared = header != &__vector_empty
+    && __atomic_load_n(&header->shares, __ATOMIC_ACQUIRE) != 0;
+  if (header == &__vector_empty || header->flags & __VECTOR_LOCAL || shared) {
+    const struct vector_allocator *allocator = header->allocator;
+    struct __vector_header_t *result;
+    if ((result = __vector_header_allocate(allocator, alignment, size)) == NULL)
+      return NULL;
+    result->flags = header->flags & __VECTOR_KEEP;
+    result->volume = header->volume;
+    result->length = header->length;
+    memcpy(result->data, header->data + skew, used - sizeof(*header));
+
+    // the reference is released just once the move succeeds, and the other
+    // references may have been deleted in the meantime
+    if (shared && __vector_share_release(header))
+      __vector_header_deallocate(header);
+    return result;
+  }
+
+  if (__builtin_add_overflow(size, alignment - _Alignof(max_align_t), &size))
+    return errno = ENOMEM, NULL;
+
+  // neither the headroom that vector_shift() leaves before the header nor the
+  // skew of its elements is part of the size, so the header is first moved
+  // back to its least offset and the elements to its data (the elements are
+  // after the header, so it can be moved first)
+  struct __vector_header_t *original = header;
+  _Bool moved = offset >= alignment || skew != 0;
+  if (moved) {
+    offset %= alignment;
+    header = memmove(object + offset, original, sizeof(*header));
+    memmove(header->data, original->data + skew, used - sizeof(*header));
+    header->offset = offset;
+  }
+
+  // a vector in the size class of a cache is moved between size classes, to an
+  // allocation from the cache if it has one, and otherwise just reallocated
+  unsigned bucket = 0;
+  if (header->allocator == NULL && alignment == _Alignof(max_align_t))
+    bucket = __vector_cache_bucket(size);
+  if (bucket != 0 && bucket == header->bucket)
+    return header;
+  if (bucket != 0 && __vector_cache.bucket[bucket] != NULL) {
+    struct __vector_header_t *result = __vector_cache_take(bucket);
+    memcpy(result, header, used);
+    __vector_cache_give(object, header->bucket);
+    result->bucket = (unsigned short) bucket;
+    return result;
+  }
+  if (bucket != 0) {
+    __vector_cache.misses++;
+    size = (size_t) 1 << bucket;
+  }
+
+  object = __vector_reallocate(header->allocator, object, size);
+  if (object == NULL) {
+    // the vector is returned to where it was (the elements first, as they're
+    // after the header) so that it's unmodified
+    if (moved) {
+      memmove(original->data + skew, header->data, used - sizeof(*header));
+      memmove(original, header, sizeof(*header));
+      original->offset = (size_t) ((char *) original - (char *) header)
+        + offset;
+    }
+    return NULL;
+  }
+  ((struct __vector_header_t *) (object + offset))->bucket =
+    (unsigned short) bucket;
+
+  // the reallocation retains the vector at its old offset, which may no longer
+  // align its data within the new allocation
+  size_t target = -((uintptr_t) object + sizeof(*header)) & (alignment - 1);
+  header = (struct __vector_header_t *) (object + target);
+  if (target != offset) {
+    memmove(header, object + offset, used);
+    header->offset = target;
+  }
+  return header;
+}
+
+__vector_inline__
+struct __vector_header_t *__vector_header_reallocate_zeroed(
+    struct __vector_header_t *header, size_t skew, size_t size, size_t used) {
+  // calloc() zeroes a fresh allocation without a pass over it where its pages
+  // are fresh from the system, which is cheaper than zeroing a reallocation if
+  // there's less of the vector to copy than to zero
+  if (header->allocator == NULL && header->alignment == _Alignof(max_align_t)
+      && __vector_cache_bucket(size) == 0 && size - used > used) {
+    struct __vector_header_t *result;
+    if ((result = calloc(1, size)) == NULL)
+      return NULL;
+    memcpy(result, header, sizeof(*header));
+    memcpy(result->data, header->data + skew, used - sizeof(*header));
+    result->offset = 0;
+    result->flags &= __VECTOR_KEEP;
+    result->bucket = 0;
+    result->shares = 0;
+    if (!(header == &__vector_empty || header->flags & __VECTOR_LOCAL)
+        && __vector_share_release(header))
+      __vector_header_deallocate(header);
+    return result;
+  }
+
+  if ((header = __vector_header_reallocate(header, skew, size, used)) == NULL)
+    return NULL;
+  memset((char *) header + used, 0, size - used);
+  return header;
+}
+
+__vector_inline__
+size_t __vector_header_usable(struct __vector_header_t *header, size_t z) {
+  size_t size = sizeof(*header) + header->volume * z;
+  size_t offset = header->offset;
+  size_t usable;
+
+  // the size that was allocated includes the slack for the alignment and any
+  // headroom before the header
+  usable = size + header->alignment - _Alignof(max_align_t);
+  usable += offset - offset % header->alignment;
+  if (header->bucket != 0 && usable < (size_t) 1 << header->bucket)
+    usable = (size_t) 1 << header->bucket;
+  usable = __vector_usable(header->allocator, (char *) header - header->offset,
+      usable);
+  return usable - header->offset - sizeof(*header);
+}
+
+__vector_inline__
+void __vector_header_deallocate(struct __vector_header_t *header) {
+  if (header->bucket != 0)
+    __vector_cache_give((char *) header - header->offset, header->bucket);
+  else
+    __vector_deallocate(header->allocator, (char *) header - header->offset);
+}
+
+__vector_inline__ _Bool __vector_share_release(
+    struct __vector_header_t *header) {
+  if (__atomic_load_n(&header->shares, __ATOMIC_ACQUIRE) == 0)
+    return 1;
+  return __atomic_fetch_sub(&header->shares, 1, __ATOMIC_ACQ_REL) == 0;
+}
+
+#endif /* VECTOR_ALLOCATOR_C */
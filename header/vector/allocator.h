@@ -0,0 +1,218 @@
+/**
+ * @file header/vector/allocator.h
+ *
+ * Each vector records the allocator that it was created with in its header.
+ * Every subsequent allocation, reallocation, and deallocation of that vector
+ * (through vector_resize(), vector_duplicate(), vector_delete(), and so on) is
+ * done through that allocator. A vector created with a @c NULL allocator, such
+ * as by vector_create() or vector_import(), uses malloc(), realloc(), and
+ * free().
+ *
+ * The header also records the alignment of the data of the vector. A vector
+ * created with vector_create_aligned() has its data aligned to more than the
+ * fundamental alignment, such as to a cache line or the width of a SIMD
+ * register, and that alignment is retained as the vector is reallocated.
+ */
+
+#ifndef VECTOR_ALLOCATOR_H
+#define VECTOR_ALLOCATOR_H
+
+#include <stddef.h>
+#include "common.h"
+
+/**
+ * @brief An allocator that a vector can be created with
+ *
+ * @par Example
+ * @code{.c}
+ *   static void *pool_allocate(size_t size, void *data) { ... }
+ *   static void *pool_reallocate(void *object, size_t size, void *data) { ... }
+ *   static void pool_deallocate(void *object, void *data) { ... }
+ *
+ *   struct vector_allocator allocator = {
+ *     .allocate = pool_allocate,
+ *     .reallocate = pool_reallocate,
+ *     .deallocate = pool_deallocate,
+ *     .data = &pool,
+ *   };
+ *
+ *   vector_on(int) vector = vector_create_in(&allocator);
+ * @endcode
+ *
+ * Each function is called with the @a data of the allocator as its last
+ * argument and must behave like its standard library counterpart: @a allocate
+ * like malloc(), @a reallocate like realloc(), and @a deallocate like free().
+ * In particular on failure @a allocate and @a reallocate must return @c NULL
+ * and set @c errno, and a failed @a reallocate must leave the @a object
+ * unmodified. Each object returned must be suitably aligned for an object of
+ * any type with fundamental alignment.
+ *
+ * The @a usable function is optional. If it's set then vector_ensure() records
+ * the whole usable size of an object that it allocates as the volume of the
+ * vector, so the allocator must retain that whole size on a @a reallocate. A
+ * vector created with a @c NULL allocator uses malloc_usable_size() where it's
+ * available (with the GNU C library).
+ *
+ * The allocator isn't copied into a vector; only its address is recorded. So
+ * the allocator must outlive each vector that's created with it.
+ */
+struct vector_allocator {
+  /// Allocate an object of @a size bytes like malloc()
+  void *(*allocate)(size_t size, void *data);
+  /// Resize the @a object to @a size bytes like realloc()
+  void *(*reallocate)(void *object, size_t size, void *data);
+  /// Deallocate the @a object like free()
+  void (*deallocate)(void *object, void *data);
+  /// The data passed as the last argument to each function
+  void *data;
+  /// Return the usable size of the @a object like malloc_usable_size() or
+  /// @c NULL if that's the size that it was allocated with
+  size_t (*usable)(void *object, void *data);
+};
+
+/**
+ * @brief Return the allocator that the @a vector was created with
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_create_in(&allocator);
+ *   vector_allocator(vector) == &allocator;
+ *
+ *   vector_on(int) target = vector_duplicate(vector);
+ *   vector_allocator(target) == &allocator;
+ * @endcode
+ *
+ * If the @a vector uses malloc(), realloc(), and free() then this is @c NULL.
+ */
+inline const struct vector_allocator *vector_allocator(vector_c vector)
+  __attribute__((nonnull, pure));
+
+/**
+ * @brief Return the alignment in bytes of the data of the @a vector
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(float) vector = vector_create_aligned(64);
+ *   vector_alignment(vector) == 64;
+ *
+ *   vector_on(float) target = vector_duplicate(vector);
+ *   vector_alignment(target) == 64;
+ * @endcode
+ *
+ * This is the alignment that the vector was created with, or the fundamental
+ * alignment <tt>_Alignof(max_align_t)</tt> if that's greater. The data of the
+ * vector retains this alignment as it's reallocated, though the first element
+ * of a vector of the fundamental alignment may be advanced within it by
+ * vector_shift().
+ */
+inline size_t vector_alignment(vector_c vector) __attribute__((nonnull, pure));
+
+/// @cond INTERNAL
+
+/// Allocate @a size bytes with the @a allocator or malloc() if it's @c NULL
+__vector_inline__ void *__vector_allocate(
+    const struct vector_allocator *allocator, size_t size)
+  __attribute__((__malloc__, warn_unused_result));
+
+/// Resize the @a object with the @a allocator or realloc() if it's @c NULL
+__vector_inline__ void *__vector_reallocate(
+    const struct vector_allocator *allocator, void *object, size_t size)
+  __attribute__((nonnull(2), warn_unused_result));
+
+/**
+ * @brief Return the usable size of the @a object of @a size bytes with the
+ *   @a allocator or malloc_usable_size() if it's @c NULL
+ *
+ * If the usable size isn't available then this is @a size.
+ */
+__vector_inline__ size_t __vector_usable(
+    const struct vector_allocator *allocator, void *object, size_t size)
+  __attribute__((nonnull(2)));
+
+/// Deallocate the @a object with the @a allocator or free() if it's @c NULL
+__vector_inline__ void __vector_deallocate(
+    const struct vector_allocator *allocator, void *object)
+  __attribute__((nonnull(2)));
+
+/**
+ * @brief Allocate a header for a vector of @a size bytes (with its header) with
+ *   the @a allocator, such that its data is aligned to @a alignment bytes
+ *
+ * The @a alignment must be a power of two of at least the fundamental
+ * alignment. This sets the allocator, offset, and alignment of the header.
+ */
+__vector_inline__ struct __vector_header_t *__vector_header_allocate(
+    const struct vector_allocator *allocator, size_t alignment, size_t size)
+  __attribute__((warn_unused_result));
+
+/**
+ * @brief Resize the allocation of the @a header to hold a vector of @a size
+ *   bytes (with its header), retaining the first @a used bytes of the vector
+ *
+ * The elements of the vector are @a skew bytes after the data of the @a header
+ * (see __vector_skew()), and they're moved to the data of the resized header.
+ * The alignment of the data of the vector is retained, so the header may be
+ * moved within its allocation after a reallocation. A vector that's shared by
+ * vector_share() is moved to an allocation of its own instead, and the
+ * reference to it is released once that succeeds.
+ */
+__vector_inline__ struct __vector_header_t *__vector_header_reallocate(
+    struct __vector_header_t *header, size_t skew, size_t size, size_t used)
+  __attribute__((nonnull, warn_unused_result));
+
+/**
+ * @brief Resize the allocation of the @a header to hold a vector of @a size
+ *   bytes (with its header), retaining the first @a used bytes of the vector
+ *   and zeroing the rest
+ *
+ * This is __vector_header_reallocate() except that the bytes from @a used to
+ * @a size, which must be greater than @a used, are zero. Where the vector is
+ * allocated by calloc() instead, those bytes aren't written at all.
+ */
+__vector_inline__
+struct __vector_header_t *__vector_header_reallocate_zeroed(
+    struct __vector_header_t *header, size_t skew, size_t size, size_t used)
+  __attribute__((nonnull, warn_unused_result));
+
+/**
+ * @brief Return the number of bytes after the header that are usable for the
+ *   data of the vector at @a header
+ *
+ * This is at least the @a volume of the vector in bytes of elements of size
+ * @a z.
+ */
+__vector_inline__
+size_t __vector_header_usable(struct __vector_header_t *header, size_t z)
+  __attribute__((nonnull));
+
+/// Deallocate the allocation of the @a header with the allocator of the vector
+__vector_inline__ void __vector_header_deallocate(
+    struct __vector_header_t *header)
+  __attribute__((nonnull));
+
+/**
+ * @brief Release a reference to the vector of the @a header
+ *
+ * Return whether the reference was its last reference, in which case the
+ * vector is to be deallocated. A vector that isn't shared by vector_share()
+ * has just the one reference.
+ */
+__vector_inline__ _Bool __vector_share_release(
+    struct __vector_header_t *header)
+  __attribute__((nonnull));
+
+/// @endcond
+
+inline const struct vector_allocator *vector_allocator(vector_c vector) {
+  return __vector_to_header(vector)->allocator;
+}
+
+inline size_t vector_alignment(vector_c vector) {
+  return __vector_to_header(vector)->alignment;
+}
+
+#endif /* VECTOR_ALLOCATOR_H */
+
+#if (-1- __vector_inline__ -1)
+#include "allocator.c"
+#endif /* __vector_inline__ */
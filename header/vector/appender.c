@@ -0,0 +1,92 @@
+/// @file header/vector/appender.c
+
+#ifndef VECTOR_APPENDER_C
+#define VECTOR_APPENDER_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "common.h"
+#include "appender.h"
+#include "access.h"
+#include "resize.h"
+#include "share.h"
+
+__vector_inline__ int vector_appender_begin_z(
+    struct vector_appender *appender, vector_t vector, size_t z) {
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return -1;
+
+  appender->vector = vector;
+  appender->z = z;
+  appender->cursor = (char *) vector + vector_length(vector) * z;
+  appender->end = (char *) vector + vector_volume(vector) * z;
+  return 0;
+}
+
+__vector_inline__
+size_t vector_appender_length(const struct vector_appender *appender) {
+  return (size_t) (appender->cursor - (char *) appender->vector) / appender->z;
+}
+
+__vector_inline__ int vector_appender_push(
+    struct vector_appender *restrict appender, const void *restrict elmt) {
+  if (appender->cursor == appender->end && __vector_appender_grow(appender, 1))
+    return -1;
+
+  if (elmt != NULL)
+    memcpy(appender->cursor, elmt, appender->z);
+  appender->cursor += appender->z;
+  return 0;
+}
+
+__vector_inline__ int vector_appender_extend(
+    struct vector_appender *restrict appender,
+    const void *restrict elmt,
+    size_t n) {
+  size_t size;
+
+  if (__builtin_mul_overflow(n, appender->z, &size))
+    return errno = ENOMEM, -1;
+  if ((size_t) (appender->end - appender->cursor) < size
+      && __vector_appender_grow(appender, n))
+    return -1;
+
+  if (elmt != NULL)
+    memcpy(appender->cursor, elmt, size);
+  appender->cursor += size;
+  return 0;
+}
+
+__vector_inline__
+vector_t vector_appender_commit(struct vector_appender *appender) {
+  size_t length = vector_appender_length(appender);
+
+  __vector_set_length(appender->vector, length);
+  return appender->vector;
+}
+
+__vector_inline__
+int __vector_appender_grow(struct vector_appender *appender, size_t n) {
+  size_t z = appender->z;
+  size_t length = vector_appender_length(appender);
+  size_t grown;
+  vector_t ensure;
+
+  if (__builtin_add_overflow(length, n, &grown))
+    return errno = ENOMEM, -1;
+
+  // the growth retains just the elements within the length of the vector, so
+  // the appended elements are committed to it first
+  vector_appender_commit(appender);
+  if ((ensure = vector_ensure_z(appender->vector, grown, z)) == NULL)
+    return -1;
+
+  appender->vector = ensure;
+  appender->cursor = (char *) ensure + length * z;
+  appender->end = (char *) ensure + vector_volume(ensure) * z;
+  return 0;
+}
+
+#endif /* VECTOR_APPENDER_C */
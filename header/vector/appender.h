@@ -0,0 +1,198 @@
+/**
+ * @file header/vector/appender.h
+ *
+ * An appender appends elements to a vector through a cursor into its unused
+ * volume, so that an append is a copy to the cursor, a bump of it, and a
+ * comparison to the end of the volume, without the header of the vector being
+ * read or written:
+ *
+ * @code{.c}
+ *   struct vector_appender appender;
+ *
+ *   vector_appender_begin(&appender, tokens);
+ *   while (next(&token))
+ *     if (vector_appender_push(&appender, &token) == -1)
+ *       break;
+ *   tokens = vector_appender_commit(&appender);
+ * @endcode
+ *
+ * While the appender is in use the appended elements are beyond the length of
+ * the vector, so the vector mustn't be operated on other than through the
+ * appender. vector_appender_commit() sets the length of the vector to include
+ * them and returns it. The appender can then be used for more appends.
+ *
+ * The vector is grown by vector_ensure_z() once the appender fills its volume,
+ * so by the growth policy of the calling thread (see vector_policy_set()).
+ */
+
+#ifndef VECTOR_APPENDER_H
+#define VECTOR_APPENDER_H
+
+#include <stddef.h>
+#include "common.h"
+
+/// An appender to a vector
+struct vector_appender {
+  /// The vector, with the appended elements beyond its length
+  vector_t vector;
+  /// The element size of the vector
+  size_t z;
+  /// The location of the next element to append
+  char *cursor;
+  /// The end of the volume of the vector
+  char *end;
+};
+
+/**
+ * @brief Begin to append to the @a vector through the @a appender
+ *
+ * @par Example
+ * @code{.c}
+ *   struct vector_appender appender;
+ *   vector_appender_begin(&appender, vector);
+ * @endcode
+ *
+ * @param appender the appender to begin
+ * @param vector the vector to append to
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_appender_begin_z() - the explicit analogue to this operation
+ */
+//= int vector_appender_begin(
+//=   struct vector_appender *appender, vector_t vector)
+#define vector_appender_begin(appender, v) \
+  vector_appender_begin_z((appender), (v), VECTOR_Z((v)))
+
+/**
+ * @brief Begin to append to the @a vector of element size @a z through the
+ *   @a appender
+ *
+ * @par Example
+ * @code{.c}
+ *   struct vector_appender appender;
+ *   vector_appender_begin_z(&appender, vector, sizeof(int));
+ * @endcode
+ *
+ * The cursor of the @a appender is set to the tail of the @a vector. The
+ * @a vector is then held by the @a appender and is invalidated, as it may be
+ * replaced by an append, until it's returned by vector_appender_commit().
+ *
+ * A @a vector that's shared by vector_share() is first unshared by
+ * vector_unshare_z(). If that fails then this returns -1 with the @a vector
+ * unmodified and the value of @c errno set by it retained.
+ *
+ * If @a z is zero then the behavior is undefined.
+ *
+ * @param appender the appender to begin
+ * @param vector the vector to append to
+ * @param z the element size of the @a vector
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_appender_begin() - the implicit analogue to this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ int vector_appender_begin_z(
+    struct vector_appender *appender, vector_t vector, size_t z);
+
+/**
+ * @brief Return the number of elements in the vector of the @a appender,
+ *   including those appended since it was last committed
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_appender_begin(&appender, vector_define(int, 1, 2, 3));
+ *   vector_appender_push(&appender, &(int) { 4 });
+ *   // vector_appender_length(&appender) == 4
+ * @endcode
+ */
+__attribute__((nonnull, pure))
+__vector_inline__
+size_t vector_appender_length(const struct vector_appender *appender);
+
+/**
+ * @brief Append the object at @a elmt to the vector of the @a appender
+ *
+ * @par Example
+ * @code{.c}
+ *   if (vector_appender_push(&appender, &token) == -1)
+ *     perror("vector_appender_push");
+ * @endcode
+ *
+ * This is vector_appender_extend() of a single element.
+ *
+ * @param appender the appender to append to
+ * @param elmt a pointer to the element to append, or @c NULL
+ * @return zero on success; otherwise -1
+ */
+__attribute__((nonnull(1), warn_unused_result))
+__vector_inline__ int vector_appender_push(
+    struct vector_appender *restrict appender, const void *restrict elmt);
+
+/**
+ * @brief Append @a n elements from @a elmt to the vector of the @a appender
+ *
+ * @par Example
+ * @code{.c}
+ *   if (vector_appender_extend(&appender, "text", 4) == -1)
+ *     perror("vector_appender_extend");
+ * @endcode
+ *
+ * The elements are copied to the cursor of the @a appender, or left
+ * uninitialized if @a elmt is @c NULL, and the cursor is advanced past them.
+ * The length of the vector is unchanged until vector_appender_commit().
+ *
+ * If the volume of the vector has fewer than @a n elements after the cursor
+ * then the vector is first grown by vector_ensure_z() to the length that
+ * includes them. If the increased length would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and fail. If the growth fails then this
+ * returns -1 with the @a appender unmodified and the value of @c errno set by
+ * realloc() retained.
+ *
+ * If any of the @a n elements at @a elmt overlap with the vector then the
+ * behavior is undefined.
+ *
+ * @param appender the appender to append to
+ * @param elmt a pointer to the elements to append, or @c NULL
+ * @param n the number of elements to append from @a elmt
+ * @return zero on success; otherwise -1
+ */
+__attribute__((nonnull(1), warn_unused_result))
+__vector_inline__ int vector_appender_extend(
+    struct vector_appender *restrict appender,
+    const void *restrict elmt,
+    size_t n);
+
+/**
+ * @brief Set the length of the vector of the @a appender to include the
+ *   appended elements and return it
+ *
+ * @par Example
+ * @code{.c}
+ *   vector = vector_appender_commit(&appender);
+ *   vector_at(vector, vector_length(vector) - 1, sizeof(int));
+ * @endcode
+ *
+ * The @a appender remains in use with its cursor at the tail of the vector,
+ * and a subsequent append through it invalidates the returned vector.
+ *
+ * @param appender the appender to commit
+ * @return the vector of the @a appender
+ */
+__attribute__((nonnull, returns_nonnull))
+__vector_inline__
+vector_t vector_appender_commit(struct vector_appender *appender);
+
+/// @cond INTERNAL
+
+/// Grow the vector of the @a appender to hold @a n elements after its cursor
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__
+int __vector_appender_grow(struct vector_appender *appender, size_t n);
+
+/// @endcond
+
+#endif /* VECTOR_APPENDER_H */
+
+#if (-1- __vector_inline__ -1)
+#include "appender.c"
+#endif /* __vector_inline__ */
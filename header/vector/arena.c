@@ -0,0 +1,157 @@
+/// @file header/vector/arena.c
+
+#ifndef VECTOR_ARENA_C
+#define VECTOR_ARENA_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "arena.h"
+#include "allocator.h"
+
+__vector_inline__ struct vector_arena *vector_arena_create(size_t size) {
+  struct vector_arena *arena;
+
+  if ((arena = malloc(sizeof(*arena))) == NULL)
+    return NULL;
+
+  arena->allocator.allocate = __vector_arena_allocate;
+  arena->allocator.reallocate = __vector_arena_reallocate;
+  arena->allocator.deallocate = __vector_arena_deallocate;
+  arena->allocator.usable = NULL;
+  arena->allocator.data = arena;
+
+  arena->block = NULL;
+  arena->head = NULL;
+  arena->tail = NULL;
+  arena->last = NULL;
+  arena->size = size;
+
+  if (size != 0 && __vector_arena_expand(arena, size) == NULL)
+    return free(arena), NULL;
+
+  return arena;
+}
+
+__vector_inline__ void vector_arena_reset(struct vector_arena *arena) {
+  struct __vector_arena_block_t *block = arena->block;
+
+  if (block == NULL)
+    return;
+
+  // retain just the last block as it's the largest
+  while (block->next != NULL) {
+    struct __vector_arena_block_t *next = block->next->next;
+    free(block->next);
+    block->next = next;
+  }
+
+  arena->head = block->data;
+  arena->last = NULL;
+}
+
+__vector_inline__ void *vector_arena_delete(struct vector_arena *arena) {
+  struct __vector_arena_block_t *block = arena->block;
+
+  while (block != NULL) {
+    struct __vector_arena_block_t *next = block->next;
+    free(block);
+    block = next;
+  }
+
+  return free(arena), NULL;
+}
+
+__vector_inline__
+void *__vector_arena_expand(struct vector_arena *arena, size_t size) {
+  struct __vector_arena_block_t *block;
+
+  if (size < arena->size)
+    size = arena->size;
+
+  size_t total;
+  if (__builtin_add_overflow(size, sizeof(*block), &total))
+    return errno = ENOMEM, NULL;
+  if ((block = malloc(total)) == NULL)
+    return NULL;
+
+  block->next = arena->block;
+  arena->block = block;
+  arena->head = block->data;
+  arena->tail = block->data + size;
+
+  // the next block will be at least twice the size of this one
+  if (__builtin_mul_overflow(size, 2, &arena->size))
+    arena->size = size;
+
+  return block;
+}
+
+__vector_inline__ void *__vector_arena_allocate(size_t size, void *data) {
+  struct vector_arena *arena = data;
+  struct __vector_arena_object_t *object;
+  const size_t a = _Alignof(max_align_t);
+
+  // round the size of the object (with its header) up to an alignment of a
+  size_t total;
+  if (__builtin_add_overflow(size, sizeof(*object) + a - 1, &total))
+    return errno = ENOMEM, NULL;
+  total &= ~(a - 1);
+
+  if ((size_t) (arena->tail - arena->head) < total) {
+    if (__vector_arena_expand(arena, total) == NULL)
+      return NULL;
+  }
+
+  object = (struct __vector_arena_object_t *) arena->head;
+  object->size = size;
+  arena->head += total;
+
+  return arena->last = object->data;
+}
+
+__vector_inline__
+void *__vector_arena_reallocate(void *object, size_t size, void *data) {
+  struct vector_arena *arena = data;
+  struct __vector_arena_object_t *header = (struct __vector_arena_object_t *)
+    ((char *) object - offsetof(struct __vector_arena_object_t, data));
+  const size_t a = _Alignof(max_align_t);
+
+  // when this is the last object, resize it in place if the region permits
+  if (object == arena->last) {
+    size_t total;
+    if (!__builtin_add_overflow(size, a - 1, &total)) {
+      total &= ~(a - 1);
+      if ((size_t) (arena->tail - (char *) object) >= total) {
+        header->size = size;
+        arena->head = (char *) object + total;
+        return object;
+      }
+    }
+  }
+
+  // a reduction of any other object is also done in place
+  if (size <= header->size)
+    return header->size = size, object;
+
+  void *result;
+  if ((result = __vector_arena_allocate(size, arena)) == NULL)
+    return NULL;
+  return memcpy(result, object, header->size);
+}
+
+__vector_inline__ void __vector_arena_deallocate(void *object, void *data) {
+  struct vector_arena *arena = data;
+
+  // only the space of the last object can be released
+  if (object == arena->last) {
+    size_t offset = offsetof(struct __vector_arena_object_t, data);
+    arena->head = (char *) object - offset;
+    arena->last = NULL;
+  }
+}
+
+#endif /* VECTOR_ARENA_C */
@@ -0,0 +1,143 @@
+/**
+ * @file header/vector/arena.h
+ *
+ * An arena is an allocator that allocates each object from a bump region and
+ * releases every object at once with vector_arena_reset(). Vectors created
+ * with the allocator of an arena never call malloc() or free() on their own:
+ *
+ * @code{.c}
+ *   struct vector_arena *arena = vector_arena_create(65536);
+ *
+ *   for (;;) {
+ *     vector_on(int) vector = vector_create_in(&arena->allocator);
+ *     vector = vector_append(vector, &(int) { 1 });
+ *     ...
+ *     vector_arena_reset(arena);
+ *   }
+ *
+ *   vector_arena_delete(arena);
+ * @endcode
+ *
+ * When a vector is the last object allocated from its arena, a reallocation of
+ * it (such as through vector_ensure()) is done in place if the region has
+ * enough space for it. Otherwise its elements are copied to a new object in
+ * the arena.
+ *
+ * A vector_delete() on a vector in an arena releases its space only if it's
+ * the last object allocated from the arena. Otherwise its space is retained
+ * until the arena is reset or deleted.
+ */
+
+#ifndef VECTOR_ARENA_H
+#define VECTOR_ARENA_H
+
+#include <stddef.h>
+#include "common.h"
+#include "allocator.h"
+
+/// @cond INTERNAL
+
+/// A block of memory that an arena allocates its objects from
+struct __vector_arena_block_t {
+  /// The block that was allocated before this one
+  struct __vector_arena_block_t *next;
+  _Alignas(max_align_t) char data[];
+};
+
+/// The header of an object that's allocated from an arena
+struct __vector_arena_object_t {
+  size_t size;
+  _Alignas(max_align_t) char data[];
+};
+
+/// @endcond
+
+/// An arena that vectors can be allocated from
+struct vector_arena {
+  /// The allocator to create vectors in this arena with
+  struct vector_allocator allocator;
+
+  /// @cond INTERNAL
+  /// The block that objects are currently allocated from
+  struct __vector_arena_block_t *block;
+  /// The start of the unused region in the current block
+  char *head;
+  /// The end of the current block
+  char *tail;
+  /// The last object that was allocated or @c NULL
+  void *last;
+  /// The size of the next block to allocate
+  size_t size;
+  /// @endcond
+};
+
+/**
+ * @brief Allocate and initialize an arena with an initial region of @a size
+ *   bytes
+ *
+ * @par Example
+ * @code{.c}
+ *   struct vector_arena *arena = vector_arena_create(65536);
+ *   vector_on(int) vector = vector_create_in(&arena->allocator);
+ * @endcode
+ *
+ * When the region of the arena is exhausted another region, at least twice the
+ * size of the last, is allocated with malloc().
+ *
+ * On failure the value of @c errno set by malloc() will be retained.
+ *
+ * @param size the size in bytes of the initial region of the arena
+ * @return the created arena on success; otherwise @c NULL
+ */
+__vector_inline__ struct vector_arena *vector_arena_create(size_t size)
+  __attribute__((__malloc__));
+
+/**
+ * @brief Release every object allocated from the @a arena
+ *
+ * This deallocates each region of the @a arena except the last (and largest)
+ * one, which is retained for subsequent allocations. Each vector allocated from
+ * the @a arena is invalidated and any subsequent access to, or operation on,
+ * it is undefined behavior.
+ *
+ * @param arena the arena to reset
+ */
+__vector_inline__ void vector_arena_reset(struct vector_arena *arena)
+  __attribute__((nonnull));
+
+/**
+ * @brief Deallocate the @a arena and return @c NULL
+ *
+ * Each vector allocated from the @a arena is invalidated and any subsequent
+ * access to, or operation on, it is undefined behavior.
+ */
+__vector_inline__ void *vector_arena_delete(struct vector_arena *arena)
+  __attribute__((nonnull));
+
+/// @cond INTERNAL
+
+/// Allocate another region of at least @a size bytes in the @a arena
+__vector_inline__ void *__vector_arena_expand(
+    struct vector_arena *arena, size_t size)
+  __attribute__((nonnull, warn_unused_result));
+
+/// Allocate an object of @a size bytes from the arena at @a data
+__vector_inline__ void *__vector_arena_allocate(size_t size, void *data)
+  __attribute__((nonnull, warn_unused_result));
+
+/// Resize the @a object to @a size bytes in the arena at @a data
+__vector_inline__ void *__vector_arena_reallocate(
+    void *object, size_t size, void *data)
+  __attribute__((nonnull, warn_unused_result));
+
+/// Deallocate the @a object in the arena at @a data
+__vector_inline__ void __vector_arena_deallocate(void *object, void *data)
+  __attribute__((nonnull));
+
+/// @endcond
+
+#endif /* VECTOR_ARENA_H */
+
+#if (-1- __vector_inline__ -1)
+#include "arena.c"
+#endif /* __vector_inline__ */
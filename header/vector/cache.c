@@ -0,0 +1,81 @@
+/// @file header/vector/cache.c
+
+#ifndef VECTOR_CACHE_C
+#define VECTOR_CACHE_C
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include "common.h"
+#include "cache.h"
+
+__vector_inline__ const struct vector_cache *vector_cache(void) {
+  return &__vector_cache;
+}
+
+__vector_inline__ void vector_cache_enable(size_t ceiling) {
+  struct vector_cache *cache = &__vector_cache;
+
+  cache->ceiling = ceiling;
+  cache->hits = 0;
+  cache->misses = 0;
+
+  // deallocate the largest allocations first until the cache is within its
+  // ceiling
+  for (unsigned bucket = sizeof(cache->bucket) / sizeof(cache->bucket[0]);
+      bucket-- != 0 && cache->size > ceiling;) {
+    while (cache->bucket[bucket] != NULL && cache->size > ceiling) {
+      void *object = cache->bucket[bucket];
+      cache->bucket[bucket] = *(void **) object;
+      cache->size -= (size_t) 1 << bucket;
+      free(object);
+    }
+  }
+}
+
+__vector_inline__ void vector_cache_disable(void) {
+  vector_cache_enable(0);
+}
+
+__vector_inline__ unsigned __vector_cache_bucket(size_t size) {
+  if (__vector_cache.ceiling == 0 || size <= 1)
+    return 0;
+  if (size > __VECTOR_CACHE_MAX)
+    return 0;
+
+  // the number of bits of size - 1, which is nonzero
+  return (unsigned) (sizeof(unsigned long long) * CHAR_BIT)
+    - (unsigned) __builtin_clzll(size - 1);
+}
+
+__vector_inline__ void *__vector_cache_take(unsigned bucket) {
+  struct vector_cache *cache = &__vector_cache;
+  void *object = cache->bucket[bucket];
+
+  if (object == NULL) {
+    cache->misses++;
+    return malloc((size_t) 1 << bucket);
+  }
+
+  cache->bucket[bucket] = *(void **) object;
+  cache->size -= (size_t) 1 << bucket;
+  cache->hits++;
+  return object;
+}
+
+__vector_inline__ void __vector_cache_give(void *object, unsigned bucket) {
+  struct vector_cache *cache = &__vector_cache;
+  size_t size = (size_t) 1 << bucket;
+
+  if (bucket == 0 || cache->ceiling - cache->size < size) {
+    free(object);
+    return;
+  }
+
+  *(void **) object = cache->bucket[bucket];
+  cache->bucket[bucket] = object;
+  cache->size += size;
+}
+
+#endif /* VECTOR_CACHE_C */
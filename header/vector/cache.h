@@ -0,0 +1,153 @@
+/**
+ * @file header/vector/cache.h
+ *
+ * A cache recycles the allocations of deleted vectors for the vectors that are
+ * subsequently allocated by the same thread, which saves the calls to malloc()
+ * and free() of a workload that repeatedly creates and deletes vectors of
+ * similar sizes. Each thread has its own cache, which is initially disabled:
+ *
+ * @code{.c}
+ *   vector_cache_enable(1 << 20);
+ *
+ *   for (size_t i = 0; i < n; i++) {
+ *     vector_on(int) vector = vector_import(data[i], length[i]);
+ *     ...
+ *     vector_delete(vector);
+ *   }
+ *
+ *   vector_cache()->hits;  // the number of allocations that were recycled
+ *   vector_cache_disable();
+ * @endcode
+ *
+ * While the cache of a thread is enabled, each vector that the thread
+ * allocates with malloc() and the default alignment (those with a @c NULL
+ * allocator that aren't created by vector_create_aligned()) has its
+ * allocation rounded up to a power of two bytes. This size class is the
+ * bucket of the cache that vector_delete() returns the allocation to and that
+ * vector_create_with(), vector_import(), vector_duplicate(), and the growth of
+ * a vector take an allocation from. A vector that grows within its size class
+ * isn't reallocated at all. Just allocations of up to 4 MiB have size classes,
+ * as rounding up a larger one wastes more than malloc() and realloc() save,
+ * so a larger vector is allocated and deallocated as usual.
+ *
+ * The cache holds no more than its ceiling in bytes. An allocation that would
+ * exceed it is deallocated by vector_delete() as usual. The allocations in the
+ * cache are deallocated only by vector_cache_disable(), which must be called
+ * before the thread exits, otherwise they're leaked.
+ */
+
+#ifndef VECTOR_CACHE_H
+#define VECTOR_CACHE_H
+
+#include <limits.h>
+#include <stddef.h>
+#include "common.h"
+
+/// The cache of allocations of a thread
+struct vector_cache {
+  /// The maximum number of bytes in the cache or zero if it's disabled
+  size_t ceiling;
+  /// The number of bytes in the cache
+  size_t size;
+  /// The number of allocations that were taken from the cache
+  size_t hits;
+  /// The number of allocations that couldn't be taken from the cache
+  size_t misses;
+  /// @cond INTERNAL
+  /// The list of allocations of each size class, linked through their first
+  /// bytes
+  void *bucket[sizeof(size_t) * CHAR_BIT];
+  /// @endcond
+};
+
+/**
+ * @brief Return the cache of the calling thread
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_cache_enable(1 << 20);
+ *   ...
+ *   const struct vector_cache *cache = vector_cache();
+ *   double rate = (double) cache->hits / (cache->hits + cache->misses);
+ * @endcode
+ *
+ * The @a hits and @a misses count the allocations of the calling thread while
+ * its cache is enabled.
+ */
+__vector_inline__ const struct vector_cache *vector_cache(void);
+
+/**
+ * @brief Enable the cache of the calling thread to hold up to @a ceiling bytes
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_cache_enable(1 << 20);
+ * @endcode
+ *
+ * If the cache is already enabled then this just changes its ceiling and
+ * deallocates the allocations in the cache that exceed it. This resets the
+ * @a hits and @a misses of the cache. If @a ceiling is zero then this is the
+ * same as vector_cache_disable().
+ *
+ * @param ceiling the maximum number of bytes in the cache
+ */
+__vector_inline__ void vector_cache_enable(size_t ceiling);
+
+/**
+ * @brief Disable the cache of the calling thread and deallocate each
+ *   allocation in it
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_cache_disable();
+ * @endcode
+ *
+ * A vector that was allocated while the cache was enabled remains valid and is
+ * deallocated by vector_delete() as usual.
+ */
+__vector_inline__ void vector_cache_disable(void);
+
+/// @cond INTERNAL
+
+/// The cache of the calling thread
+extern _Thread_local struct vector_cache __vector_cache;
+
+/// The size of the largest size class of a cache
+#define __VECTOR_CACHE_MAX ((size_t) 1 << 22)
+
+/**
+ * @brief Return the size class of an allocation of @a size bytes in the cache
+ *   of the calling thread
+ *
+ * This is the base 2 logarithm of @a size rounded up to a power of two. If the
+ * cache is disabled or @a size exceeds ::__VECTOR_CACHE_MAX then this is zero.
+ */
+__vector_inline__ unsigned __vector_cache_bucket(size_t size)
+  __attribute__((pure));
+
+/**
+ * @brief Return an allocation of size class @a bucket from the cache of the
+ *   calling thread or allocate one with malloc()
+ *
+ * The allocation is counted as a hit or a miss of the cache respectively. If
+ * the allocation fails then this is @c NULL.
+ */
+__vector_inline__ void *__vector_cache_take(unsigned bucket)
+  __attribute__((__malloc__, warn_unused_result));
+
+/**
+ * @brief Return an @a object of size class @a bucket to the cache of the
+ *   calling thread or deallocate it with free()
+ *
+ * The @a object is deallocated if the cache is disabled, if @a bucket is zero,
+ * or if it would exceed the ceiling of the cache.
+ */
+__vector_inline__ void __vector_cache_give(void *object, unsigned bucket);
+
+/// @endcond
+
+#endif /* VECTOR_CACHE_H */
+
+#if (-1- __vector_inline__ -1)
+#include "cache.c"
+#endif /* __vector_inline__ */
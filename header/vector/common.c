@@ -5,4 +5,10 @@
 
 #include "common.h"
 
+__vector_inline__ void __vector_set_length(vector_t vector, size_t length) {
+  // the empty vector is read-only but its length is already zero
+  if (vector_length(vector) != length)
+    __vector_to_header(vector)->length = length;
+}
+
 #endif /* VECTOR_COMMON_C */
@@ -4,6 +4,7 @@
 #define VECTOR_COMMON_H
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * @brief The type of a vector with the operand as the element type
@@ -173,9 +174,69 @@ inline size_t vector_length(vector_c vector) __attribute__((nonnull, pure));
 struct __vector_header_t {
   size_t volume;
   size_t length;
+  /// The allocator of the vector or @c NULL to use malloc(), realloc(), free()
+  const struct vector_allocator *allocator;
+  /// The offset in bytes of the header from the start of its allocation, which
+  /// includes the headroom that vector_shift() leaves before the header in a
+  /// multiple of the alignment (see __vector_skew())
+  size_t offset;
+  /// The alignment in bytes of the data of the vector
+  size_t alignment;
+  /// A combination of the @c __VECTOR_* flags of the vector
+  unsigned short flags;
+  /// The base 2 logarithm of the size of the allocation of the vector, if it's
+  /// a size class of a cache, or zero (see vector_cache_enable())
+  unsigned short bucket;
+  /// The number of references to the vector by vector_share() that are yet to
+  /// be deleted or unshared
+  unsigned shares;
   _Alignas(max_align_t) char data[];
 };
 
+/// The flag of a vector in storage that it doesn't own, which isn't
+/// reallocated or deallocated but replaced by an allocation on its growth
+#define __VECTOR_LOCAL 0x1u
+
+/// The flag of a vector in a memory mapping of a file, which holds no other
+/// vector (see vector_file_open())
+#define __VECTOR_MAPPED 0x2u
+
+/// The flag of a vector whose volume isn't reduced on the removal of its
+/// elements (see vector_policy_keep())
+#define __VECTOR_KEEP 0x4u
+
+/**
+ * @brief The header of every empty vector that has no allocation
+ *
+ * vector_create() returns the data of this header rather than allocate a
+ * vector with zero @volume. As it's read-only, an operation must never write
+ * to it. It has the ::__VECTOR_LOCAL flag so that, as with other storage that
+ * a vector doesn't own, it's replaced by an allocation on the first growth of
+ * the vector and vector_delete() doesn't deallocate it.
+ */
+extern const struct __vector_header_t __vector_empty;
+
+/// Return the data of ::__vector_empty as a @ref vector_t
+#define __vector_empty_data() ({ \
+  _Pragma("GCC diagnostic push"); \
+  _Pragma("GCC diagnostic ignored \"-Wcast-qual\""); \
+  (vector_t) __vector_empty.data; \
+  _Pragma("GCC diagnostic pop") \
+})
+
+/**
+ * @brief Return the number of bytes that the first element of the @a vector is
+ *   after the data of its header
+ *
+ * vector_shift() advances the first element of a vector by its element size
+ * but moves the header just by a multiple of the fundamental alignment, so the
+ * first element can be less than that alignment after the data of the header.
+ * The data of the header is aligned to the fundamental alignment, so this is
+ * the remainder of the address of the @a vector by it.
+ */
+#define __vector_skew(vector) \
+  ((size_t) ((uintptr_t) (vector) & (_Alignof(max_align_t) - 1)))
+
 /**
  * @brief Return the header associated with the @a vector
  *
@@ -188,10 +249,13 @@ struct __vector_header_t {
   _Pragma("GCC diagnostic push"); \
   _Pragma("GCC diagnostic ignored \"-Wcast-align\""); \
   _Pragma("GCC diagnostic ignored \"-Wcast-qual\""); \
-  _Generic((vector), vector_t: (struct __vector_header_t *) ( \
-      (/* */ char *) (vector) - offsetof(struct __vector_header_t, data) \
+  __typeof__((vector)) __vector_skewed = (vector); \
+  _Generic(__vector_skewed, vector_t: (struct __vector_header_t *) ( \
+      (/* */ char *) __vector_skewed - __vector_skew(__vector_skewed) \
+        - offsetof(struct __vector_header_t, data) \
     ), vector_c: (const struct __vector_header_t *) ( \
-      (const char *) (vector) - offsetof(struct __vector_header_t, data) \
+      (const char *) __vector_skewed - __vector_skew(__vector_skewed) \
+        - offsetof(struct __vector_header_t, data) \
     )); \
   _Pragma("GCC diagnostic pop") \
 })
@@ -206,6 +270,16 @@ struct __vector_header_t {
 #define __vector_inline__ inline
 #endif /* __vector_inline__ */
 
+/**
+ * @brief Set the length of the @a vector to @a length
+ *
+ * The length isn't written when it's already @a length, so that this doesn't
+ * modify ::__vector_empty, which is read-only, when the length of an empty
+ * vector is unchanged.
+ */
+__attribute__((nonnull)) __vector_inline__
+void __vector_set_length(vector_t vector, size_t length);
+
 /// @endcond
 
 inline size_t vector_volume(vector_c vector) {
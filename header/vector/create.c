@@ -5,16 +5,63 @@
 
 #include <errno.h>
 #include <stddef.h>
-#include <stdlib.h>
 #include <string.h>
 
 #include "common.h"
 #include "create.h"
+#include "allocator.h"
 
 __vector_inline__ vector_t vector_create(void) {
+  return vector_create_in(NULL);
+}
+
+__vector_inline__
+vector_t vector_create_in(const struct vector_allocator *allocator) {
+  return vector_create_aligned_in(allocator, _Alignof(max_align_t));
+}
+
+__vector_inline__ vector_t vector_create_with_z(size_t volume, size_t z) {
+  struct __vector_header_t *header;
+  size_t size;
+
+  if (volume == 0)
+    return vector_create();
+
+  // calculate size and test for overflow
+  if (__builtin_mul_overflow(volume, z, &size))
+    return errno = ENOMEM, NULL;
+  if (__builtin_add_overflow(size, sizeof(*header), &size))
+    return errno = ENOMEM, NULL;
+
+  header = __vector_header_allocate(NULL, _Alignof(max_align_t), size);
+  if (header == NULL)
+    return NULL;
+
+  header->volume = volume;
+  header->length = 0;
+  return header->data;
+}
+
+__vector_inline__ vector_t vector_create_aligned(size_t alignment) {
+  return vector_create_aligned_in(NULL, alignment);
+}
+
+__vector_inline__ vector_t vector_create_aligned_in(
+    const struct vector_allocator *allocator, size_t alignment) {
   struct __vector_header_t *header;
 
-  if ((header = malloc(sizeof(*header))) == NULL)
+  // alignment must be a power of two
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+    return errno = EINVAL, NULL;
+  if (alignment < _Alignof(max_align_t))
+    alignment = _Alignof(max_align_t);
+
+  // an empty vector of malloc() needs no allocation until it grows
+  if (allocator == NULL && alignment == _Alignof(max_align_t))
+    return __vector_empty_data();
+
+  header = __vector_header_allocate(allocator, alignment, sizeof(*header));
+  if (header == NULL)
     return NULL;
 
   header->volume = 0;
@@ -22,15 +69,42 @@ __vector_inline__ vector_t vector_create(void) {
   return header->data;
 }
 
+__vector_inline__
+vector_t vector_create_local(void *storage, size_t size, size_t z) {
+  struct __vector_header_t *header = storage;
+
+  header->volume = (size - sizeof(*header)) / z;
+  header->length = 0;
+  header->allocator = NULL;
+  header->offset = 0;
+  header->alignment = _Alignof(max_align_t);
+  header->flags = __VECTOR_LOCAL;
+  header->bucket = 0;
+  header->shares = 0;
+  return header->data;
+}
+
 __vector_inline__
 vector_t vector_import_z(const void *data, size_t length, size_t z) {
+  return vector_import_in_z(NULL, data, length, z);
+}
+
+__vector_inline__ vector_t vector_import_in_z(
+    const struct vector_allocator *allocator,
+    const void *data,
+    size_t length,
+    size_t z) {
   struct __vector_header_t *header;
 
+  if (allocator == NULL && length == 0)
+    return __vector_empty_data();
+
   // Doesn't overflow because this is the size of data
   size_t size = length * z;
   if (__builtin_add_overflow(size, sizeof(*header), &size))
     return errno = ENOMEM, NULL;
-  if ((header = malloc(size)) == NULL)
+  header = __vector_header_allocate(allocator, _Alignof(max_align_t), size);
+  if (header == NULL)
     return NULL;
 
   header->volume = length;
@@ -39,22 +113,37 @@ vector_t vector_import_z(const void *data, size_t length, size_t z) {
 }
 
 __vector_inline__ vector_t vector_duplicate_z(vector_c source, size_t z) {
+  const struct vector_allocator *allocator = vector_allocator(source);
+  size_t alignment = vector_alignment(source);
   struct __vector_header_t *header;
 
+  // the allocator of a file holds just the one vector, so the duplicate of a
+  // vector in a file mapping, as of one in local storage, is allocated by
+  // malloc()
+  if (__vector_to_header(source)->flags & (__VECTOR_LOCAL | __VECTOR_MAPPED))
+    allocator = NULL;
+
   size_t volume = vector_volume(source);
   size_t length = vector_length(source);
+  size_t size;
 
-  if ((header = malloc(sizeof(*header) + volume * z)) == NULL) {
+  if (allocator == NULL && alignment == _Alignof(max_align_t) && volume == 0)
+    return __vector_empty_data();
+
+  size = sizeof(*header) + volume * z;
+  header = __vector_header_allocate(allocator, alignment, size);
+  if (header == NULL) {
     if (length == volume)
       return NULL;
-    if ((header = malloc(sizeof(*header) + length * z)) == NULL)
+    size = sizeof(*header) + length * z;
+    header = __vector_header_allocate(allocator, alignment, size);
+    if (header == NULL)
       return NULL;
     header->volume = length;
   } else
     header->volume = volume;
 
   header->length = length;
-
   return memcpy(header->data, source, length * z);
 }
 
@@ -5,9 +5,10 @@
 
 #include <stddef.h>
 #include "common.h"
+#include "allocator.h"
 
 /**
- * @brief Allocate and initialize a vector with zero @length and @volume
+ * @brief Create a vector with zero @length and @volume without an allocation
  *
  * @par Example
  * @code{.c}
@@ -15,12 +16,246 @@
  * @endcode
  *
  * The created vector has no element type and will be suitably aligned for
- * elements of any object type with fundamental alignment. On failure the value
- * of @c errno set by malloc() will be retained.
+ * elements of any object type with fundamental alignment.
  *
+ * This doesn't allocate. Each vector that's created by this shares a read-only
+ * header until its first growth (such as through vector_ensure() or
+ * vector_append()) replaces that header with an allocation from malloc(). So
+ * this never fails and a vector_delete() of the created vector before then
+ * doesn't call free(). The same is true of a vector_import() of zero elements
+ * and of a vector_duplicate() of a vector of malloc() with zero @volume.
+ *
+ * @return the created vector
+ */
+__vector_inline__ vector_t vector_create(void);
+
+/**
+ * @brief Create a vector with zero @length and @volume that's allocated with
+ *   the @a allocator
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_create_in(&allocator);
+ * @endcode
+ *
+ * This is vector_create() except that the created vector, and each subsequent
+ * reallocation and deallocation of it, is allocated with the @a allocator. If
+ * the @a allocator is @c NULL then this is just vector_create(), which doesn't
+ * allocate, and malloc(), realloc(), and free() are used once the vector
+ * grows. On failure the value of @c errno set by the @a allocator will be
+ * retained.
+ *
+ * @param allocator the allocator of the vector or @c NULL
  * @return the created vector on success; otherwise @c NULL
  */
-__vector_inline__ vector_t vector_create(void) __attribute__((__malloc__));
+__vector_inline__
+vector_t vector_create_in(const struct vector_allocator *allocator);
+
+/**
+ * @brief Create a vector of @a type with zero @length and a @volume of
+ *   @a volume
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_create_with(int, 1000);
+ *   // vector_length(vector) == 0 && vector_volume(vector) == 1000
+ * @endcode
+ *
+ * This is vector_create() except that the created vector is allocated with
+ * room for @a volume elements, so when the final length of a vector is known
+ * it can be built without a reallocation or any volume beyond what's needed.
+ * If @a volume is zero then this is just vector_create(), which doesn't
+ * allocate.
+ *
+ * On failure the value of @c errno set by malloc() will be retained.
+ *
+ * @param type a complete object type
+ * @param volume the volume of the created vector
+ * @return the created vector of element type @a type on success; otherwise
+ *   @c NULL
+ *
+ * @see vector_create_with_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_create_with(type, size_t volume)
+#define vector_create_with(type, ...) \
+  ((vector_on(type)) vector_create_with_z(__VA_ARGS__, sizeof(type)))
+
+/**
+ * @brief Create a vector with zero @length and a @volume of @a volume
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_create_with_z(1000, sizeof(int));
+ *   // vector_length(vector) == 0 && vector_volume(vector) == 1000
+ * @endcode
+ *
+ * This is vector_create() except that the created vector is allocated with
+ * room for @a volume elements of size @a z. If @a volume is zero then this is
+ * just vector_create(), which doesn't allocate.
+ *
+ * With a @a volume that causes the size of the vector to overflow a
+ * @c size_t, this returns @c NULL with @c errno set to @c ENOMEM. On any other
+ * failure the value of @c errno set by malloc() will be retained.
+ *
+ * @param volume the volume of the created vector
+ * @param z the element size of the created vector
+ * @return the created vector on success; otherwise @c NULL
+ *
+ * @see vector_create_with() - the implicit analogue to this operation
+ */
+__vector_inline__ vector_t vector_create_with_z(size_t volume, size_t z);
+
+/**
+ * @brief Create a vector with zero @length and @volume and its data aligned
+ *   to @a alignment bytes
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(float) vector = vector_create_aligned(64);
+ *   // vector is aligned to 64 bytes
+ * @endcode
+ *
+ * This is vector_create() except that the data of the created vector, after
+ * each subsequent reallocation of it by vector_resize(), vector_ensure(), and
+ * so on, is aligned to @a alignment bytes. This permits aligned SIMD loads and
+ * stores of its elements, or elements that are each on their own cache line.
+ * An @a alignment less than the fundamental alignment is increased to it. With
+ * the fundamental alignment this is just vector_create(), which doesn't
+ * allocate.
+ *
+ * If @a alignment isn't a power of two then this returns @c NULL with @c errno
+ * set to @c EINVAL. On any other failure the value of @c errno set by malloc()
+ * will be retained.
+ *
+ * A reallocation that moves the vector to an address with a different
+ * alignment must also move its elements within the allocation, so some
+ * reallocations of an aligned vector have the cost of a copy.
+ *
+ * @param alignment the alignment of the data of the vector in bytes
+ * @return the created vector on success; otherwise @c NULL
+ */
+__vector_inline__ vector_t vector_create_aligned(size_t alignment);
+
+/**
+ * @brief Create a vector with zero @length and @volume and its data aligned
+ *   to @a alignment bytes that's allocated with the @a allocator
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(float) vector = vector_create_aligned_in(&allocator, 64);
+ * @endcode
+ *
+ * This is vector_create_aligned() except that the created vector, and each
+ * subsequent reallocation and deallocation of it, is allocated with the
+ * @a allocator. If the @a allocator is @c NULL then malloc(), realloc(), and
+ * free() are used. On failure other than of the @a alignment the value of
+ * @c errno set by the @a allocator will be retained.
+ *
+ * @param allocator the allocator of the vector or @c NULL
+ * @param alignment the alignment of the data of the vector in bytes
+ * @return the created vector on success; otherwise @c NULL
+ */
+__vector_inline__ vector_t vector_create_aligned_in(
+    const struct vector_allocator *allocator, size_t alignment);
+
+/**
+ * @brief The type of storage for a vector of @a volume elements of @a type
+ *
+ * @par Example
+ * @code{.c}
+ *   struct node {
+ *     vector_storage(struct node *, 8) storage;
+ *     vector_on(struct node *) edges;
+ *   } node;
+ *
+ *   node.edges = vector_create_local(
+ *     &node.storage, sizeof(node.storage), sizeof(struct node *));
+ * @endcode
+ *
+ * This is a structure type with the size and alignment for a vector of @a type
+ * with a @volume of @a volume to be created in it by vector_create_local(),
+ * such as a member of another structure. @a volume must be an integer constant
+ * expression.
+ *
+ * @param type a complete object type
+ * @param volume the volume of a vector in the storage
+ * @return the name of a structure type for the storage of a vector
+ */
+#define vector_storage(type, volume) struct { \
+  _Alignas(struct __vector_header_t) char __storage[ \
+    offsetof(struct __vector_header_t, data) + sizeof(type) * (volume) \
+  ]; \
+}
+
+/**
+ * @brief Initialize a vector with zero @length in the @a storage of @a size
+ *   bytes
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_storage(int, 16) storage;
+ *   vector_on(int) vector =
+ *     vector_create_local(&storage, sizeof(storage), sizeof(int));
+ * @endcode
+ *
+ * The created vector has its header and elements in the @a storage with as
+ * many elements of size @a z as fit in it as its @volume, so that it doesn't
+ * allocate until it grows beyond that volume. On that growth its elements are
+ * moved to an allocation from malloc() and each subsequent reallocation and
+ * deallocation is as for a vector from vector_create(). A vector_delete() of
+ * it while it's still in the @a storage doesn't call free(). Its volume isn't
+ * reduced while it's in the @a storage, by vector_resize(), vector_shrink(), or
+ * a removal, so it can always grow back to the volume of the @a storage.
+ *
+ * The @a storage isn't otherwise managed by the vector, so it must outlive the
+ * vector while the vector is in it.
+ *
+ * @warning @parblock The behavior of this operation is undefined when:
+ *   - The @a storage isn't suitably aligned for a ::vector_storage()
+ *   - @a size is less than the size of a ::vector_storage() of @a volume 0
+ *   - @a z isn't the element size of the vector
+ * @endparblock
+ *
+ * @param storage the storage for the vector
+ * @param size the size of the @a storage in bytes
+ * @param z the element size of the vector
+ * @return the created vector
+ */
+__attribute__((nonnull))
+__vector_inline__
+vector_t vector_create_local(void *storage, size_t size, size_t z);
+
+/**
+ * @brief Initialize a vector with zero @length in automatic storage for
+ *   @a volume elements of @a type
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define_local(int, 16);
+ *
+ *   for (int i = 0; i < 16; i++)
+ *     vector = vector_append(vector, &i);  // doesn't allocate
+ *
+ *   vector = vector_append(vector, &(int) { 16 });  // moves to malloc()
+ *   vector_delete(vector);
+ * @endcode
+ *
+ * This is vector_create_local() with storage that's a compound literal of
+ * ::vector_storage(). Within a function the storage has automatic storage
+ * duration, so the created vector must be deleted, or moved out of the storage
+ * by growth, before the end of the enclosing block. @a volume must be an
+ * integer constant expression.
+ *
+ * @param type a complete object type
+ * @param volume the volume of the vector before it first allocates
+ * @return the created vector of element type @a type
+ */
+#define vector_define_local(type, volume) ( \
+  (vector_on(type)) vector_create_local( \
+    &(vector_storage(type, (volume))) { { 0 } }, \
+    sizeof(vector_storage(type, (volume))), sizeof(type) \
+  ) \
+)
 
 /**
  * @brief Allocate and initialize a vector from @a length elements of @a data
@@ -85,10 +320,69 @@ __vector_inline__ vector_t vector_create(void) __attribute__((__malloc__));
  *
  * @see vector_import() - the implicit analogue to this operation
  */
-__attribute__((__malloc__, nonnull))
+__attribute__((nonnull))
 __vector_inline__
 vector_t vector_import_z(const void *data, size_t length, size_t z);
 
+/**
+ * @brief Allocate and initialize a vector from @a length elements of @a data
+ *   with the @a allocator
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_import_in(&allocator, (int[]) { 1, 2 }, 2);
+ *   // vector ≡ [1, 2]
+ * @endcode
+ *
+ * This is vector_import() except that the created vector, and each subsequent
+ * reallocation and deallocation of it, is allocated with the @a allocator. If
+ * the @a allocator is @c NULL then malloc(), realloc(), and free() are used.
+ * On failure the value of @c errno set by the @a allocator will be retained.
+ *
+ * @param allocator the allocator of the vector or @c NULL
+ * @param data a pointer to the elements used to initialize the vector
+ * @param length the number of elements from @a data to copy into the vector
+ * @return the created vector on success; otherwise @c NULL
+ *
+ * @see vector_import_in_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_import_in(
+//=   const struct vector_allocator *allocator, const void *data, size_t length)
+#define vector_import_in(a, d, ...) \
+  vector_import_in_z((a), (d), __VA_ARGS__, VECTOR_Z((d)))
+
+/**
+ * @brief Allocate and initialize a vector from @a length elements of @a data
+ *   with the @a allocator
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector =
+ *     vector_import_in_z(&allocator, (int[]) { 1, 2 }, 2, sizeof(int));
+ *   // vector ≡ [1, 2]
+ * @endcode
+ *
+ * This is vector_import_z() except that the created vector, and each
+ * subsequent reallocation and deallocation of it, is allocated with the
+ * @a allocator. If the @a allocator is @c NULL then malloc(), realloc(), and
+ * free() are used. On failure the value of @c errno set by the @a allocator
+ * will be retained.
+ *
+ * @param allocator the allocator of the vector or @c NULL
+ * @param data a pointer to the elements used to initialize the vector
+ * @param length the number of elements from @a data to copy into the vector
+ * @param z the element size of @a data
+ * @return the created vector on success; otherwise @c NULL
+ *
+ * @see vector_import_in() - the implicit analogue to this operation
+ */
+__attribute__((nonnull(2)))
+__vector_inline__ vector_t vector_import_in_z(
+    const struct vector_allocator *allocator,
+    const void *data,
+    size_t length,
+    size_t z);
+
 /**
  * @brief Allocate and initialize a vector from the argument list
  *
@@ -151,7 +445,10 @@ vector_t vector_import_z(const void *data, size_t length, size_t z);
  * source. If either attempt is successful, then this will memcpy() each element
  * in @a source into the created vector. Its element type is the same as the
  * element type of @a source and it will be suitably aligned for elements of any
- * object type with fundamental alignment.
+ * object type with fundamental alignment. The created vector is allocated with
+ * the same allocator, and has the same alignment, as the @a source, except
+ * that the duplicate of a vector in a file (see vector_file_open()) is
+ * allocated with malloc().
  *
  * On failure the value of @c errno set by malloc() will be retained.
  *
@@ -181,7 +478,10 @@ vector_t vector_import_z(const void *data, size_t length, size_t z);
  * source. If either attempt is successful, then this will memcpy() each element
  * in @a source into the created vector. Its element type is the same as the
  * element type of @a source and it will be suitably aligned for elements of any
- * object type with fundamental alignment.
+ * object type with fundamental alignment. The created vector is allocated with
+ * the same allocator, and has the same alignment, as the @a source, except
+ * that the duplicate of a vector in a file (see vector_file_open()) is
+ * allocated with malloc().
  *
  * On failure the value of @c errno set by malloc() will be retained.
  *
@@ -194,7 +494,7 @@ vector_t vector_import_z(const void *data, size_t length, size_t z);
  *
  * @see vector_duplicate() - the implicit analogue to this operation
  */
-__attribute__((__malloc__, nonnull))
+__attribute__((nonnull))
 __vector_inline__
 vector_t vector_duplicate_z(vector_c source, size_t z);
 
@@ -3,13 +3,17 @@
 #ifndef VECTOR_DELETE_C
 #define VECTOR_DELETE_C
 
-#include <stdlib.h>
-
 #include "common.h"
 #include "delete.h"
+#include "allocator.h"
 
 __vector_inline__ void *vector_delete(vector_t vector) {
-  return free(__vector_to_header(vector)), NULL;
+  struct __vector_header_t *header = __vector_to_header(vector);
+
+  // a shared vector is deallocated by the last of its references
+  if (!(header->flags & __VECTOR_LOCAL) && __vector_share_release(header))
+    __vector_header_deallocate(header);
+  return NULL;
 }
 
 #endif /* VECTOR_DELETE_C */
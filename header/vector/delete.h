@@ -5,7 +5,13 @@
 
 #include "common.h"
 
-/// Deallocate the @a vector and return @c NULL
+/**
+ * @brief Deallocate the @a vector and return @c NULL
+ *
+ * If the @a vector is shared by vector_share() then this just releases this
+ * reference to it, and the @a vector is deallocated once each of its
+ * references is deleted.
+ */
 __vector_inline__ void *vector_delete(vector_t vector) __attribute__((nonnull));
 
 #endif /* VECTOR_DELETE_H */
@@ -0,0 +1,264 @@
+/// @file header/vector/file.c
+
+#ifndef VECTOR_FILE_C
+#define VECTOR_FILE_C
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "file.h"
+#include "allocator.h"
+#include "create.h"
+
+/**
+ * Calculate the @a length of the mapping of a file with an object of @a size
+ * bytes, which is a whole number of pages. Return zero if the @a length would
+ * overflow a @c size_t or an @c off_t.
+ */
+static _Bool __vector_file_length(size_t size, size_t *length) {
+  size_t page = (size_t) sysconf(_SC_PAGESIZE);
+
+  if (__builtin_add_overflow(size,
+        offsetof(struct __vector_file_object_t, data) + page - 1, length))
+    return 0;
+  *length -= *length % page;
+  return (off_t) *length >= 0 && (size_t) (off_t) *length == *length;
+}
+
+/**
+ * Return whether the mapping of @a length bytes at @a object, which is at least
+ * the size of both headers, is a file of a vector of element size @a z that
+ * can be used as is.
+ */
+static _Bool __vector_file_valid(
+    const struct __vector_file_object_t *object, size_t length, size_t z) {
+  const struct __vector_header_t *header =
+    (const struct __vector_header_t *) object->data;
+  size_t size;
+
+  // the volume of the vector may include the excess of its last page
+  length -= offsetof(struct __vector_file_object_t, data) + sizeof(*header);
+
+  if (object->magic != __VECTOR_FILE_MAGIC || object->z != z)
+    return 0;
+  if (header->alignment != _Alignof(max_align_t))
+    return 0;
+  if (header->length > header->volume)
+    return 0;
+  if (__builtin_mul_overflow(header->volume, z, &size))
+    return 0;
+  return size <= length;
+}
+
+/**
+ * Open the vector in the file at the descriptor @a fd, which the @a file takes
+ * ownership of, as vector_file_open_z() or, if @a readonly, as
+ * vector_file_attach_z(). On failure close @a fd and return @c NULL.
+ */
+static vector_t __vector_file_open(
+    struct vector_file *file, int fd, size_t z, _Bool readonly) {
+  struct __vector_file_object_t *object;
+  struct __vector_header_t *header;
+  struct stat status;
+  size_t length;
+  int error;
+
+  file->allocator.allocate = __vector_file_allocate;
+  file->allocator.reallocate = __vector_file_reallocate;
+  file->allocator.deallocate = __vector_file_deallocate;
+  file->allocator.usable = __vector_file_usable;
+  file->allocator.data = file;
+  file->fd = fd;
+  file->z = z;
+  file->mapping = 0;
+  file->readonly = readonly;
+
+  if (fstat(file->fd, &status) != 0)
+    goto fail;
+
+  // an empty file is given a new vector, which is flagged as it is on a
+  // reopen so that its header is never moved from the start of the file
+  if (status.st_size == 0 && !readonly) {
+    vector_t vector = vector_create_in(&file->allocator);
+    if (vector == NULL)
+      goto fail;
+    __vector_to_header(vector)->flags |= __VECTOR_MAPPED;
+    return vector;
+  }
+
+  length = (size_t) status.st_size;
+  if ((uintmax_t) status.st_size > SIZE_MAX
+      || length < sizeof(*object) + sizeof(*header)) {
+    errno = EINVAL;
+    goto fail;
+  }
+
+  // an attached vector is mapped privately so that its header can be written
+  // to without the writes reaching the file, and the rest of its pages are
+  // still those of the file
+  object = mmap(NULL, length, PROT_READ | PROT_WRITE,
+      readonly ? MAP_PRIVATE : MAP_SHARED, file->fd, 0);
+  if (object == MAP_FAILED)
+    goto fail;
+  if (!__vector_file_valid(object, length, z)) {
+    munmap(object, length);
+    errno = EINVAL;
+    goto fail;
+  }
+  file->mapping = length;
+
+  // the fields of the header that refer to the process that wrote the file are
+  // replaced with those of this one, though the vector keeps its volume if it
+  // was set to
+  header = (struct __vector_header_t *) object->data;
+  header->allocator = &file->allocator;
+  header->offset = 0;
+  header->flags = (unsigned short) ((header->flags & __VECTOR_KEEP)
+    | __VECTOR_MAPPED);
+  header->bucket = 0;
+  header->shares = 0;
+
+  if (readonly && mprotect(object, length, PROT_READ) != 0) {
+    munmap(object, length);
+    goto fail;
+  }
+  return header->data;
+
+fail:
+  error = errno;
+  close(file->fd);
+  file->fd = -1;
+  file->mapping = 0;
+  errno = error;
+  return NULL;
+}
+
+vector_t vector_file_open_z(
+    struct vector_file *file, const char *path, size_t z) {
+  int fd;
+
+  if ((fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0666)) < 0)
+    return NULL;
+  return __vector_file_open(file, fd, z, 0);
+}
+
+vector_t vector_file_open_fd_z(struct vector_file *file, int fd, size_t z) {
+  if ((fd = fcntl(fd, F_DUPFD_CLOEXEC, 0)) < 0)
+    return NULL;
+  return __vector_file_open(file, fd, z, 0);
+}
+
+vector_c vector_file_attach_z(struct vector_file *file, int fd, size_t z) {
+  if ((fd = fcntl(fd, F_DUPFD_CLOEXEC, 0)) < 0)
+    return NULL;
+  return __vector_file_open(file, fd, z, 1);
+}
+
+void *vector_file_detach(vector_c vector) {
+  const struct __vector_header_t *header = __vector_to_header(vector);
+  struct vector_file *file = header->allocator->data;
+
+  // the header is the object that the file allocated, which is just unmapped
+  __vector_file_deallocate((void *) header, file);
+  return NULL;
+}
+
+int vector_file_sync(vector_c vector) {
+  const struct __vector_header_t *header = __vector_to_header(vector);
+  struct vector_file *file = header->allocator->data;
+  const char *object = (const char *) header
+    - offsetof(struct __vector_file_object_t, data);
+
+  if (msync((void *) object, file->mapping, MS_SYNC) != 0)
+    return -1;
+  return fsync(file->fd);
+}
+
+void *__vector_file_allocate(size_t size, void *data) {
+  struct vector_file *file = data;
+  struct __vector_file_object_t *object;
+  size_t length;
+
+  // the file holds just the one vector
+  if (file->mapping != 0)
+    return errno = EBUSY, NULL;
+  if (file->readonly)
+    return errno = EPERM, NULL;
+
+  if (!__vector_file_length(size, &length))
+    return errno = ENOMEM, NULL;
+  if (ftruncate(file->fd, (off_t) length) != 0)
+    return NULL;
+  object = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED, file->fd, 0);
+  if (object == MAP_FAILED)
+    return NULL;
+
+  file->mapping = length;
+  object->magic = __VECTOR_FILE_MAGIC;
+  object->z = file->z;
+  return object->data;
+}
+
+void *__vector_file_reallocate(void *object, size_t size, void *data) {
+  struct vector_file *file = data;
+  struct __vector_file_object_t *header = (struct __vector_file_object_t *)
+    ((char *) object - offsetof(struct __vector_file_object_t, data));
+  size_t length;
+
+  if (file->readonly)
+    return errno = EPERM, NULL;
+  if (!__vector_file_length(size, &length))
+    return errno = ENOMEM, NULL;
+
+  if (length != file->mapping) {
+    void *mapping;
+
+    // the file is extended before its mapping and truncated after it
+    if (length > file->mapping && ftruncate(file->fd, (off_t) length) != 0)
+      return NULL;
+#ifdef MREMAP_MAYMOVE
+    mapping = mremap(header, file->mapping, length, MREMAP_MAYMOVE);
+    if (mapping == MAP_FAILED)
+      return NULL;
+#else
+    // both mappings share the pages of the file, so nothing is copied
+    mapping = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_SHARED,
+        file->fd, 0);
+    if (mapping == MAP_FAILED)
+      return NULL;
+    munmap(header, file->mapping);
+#endif /* MREMAP_MAYMOVE */
+    // a file that fails to be truncated just retains its excess pages
+    if (length < file->mapping)
+      (void) !ftruncate(file->fd, (off_t) length);
+
+    header = mapping;
+    file->mapping = length;
+  }
+
+  return header->data;
+}
+
+void __vector_file_deallocate(void *object, void *data) {
+  struct vector_file *file = data;
+
+  munmap((char *) object - offsetof(struct __vector_file_object_t, data),
+      file->mapping);
+  close(file->fd);
+  file->fd = -1;
+  file->mapping = 0;
+}
+
+size_t __vector_file_usable(void *object, void *data) {
+  const struct vector_file *file = data;
+  (void) object;
+  return file->mapping - offsetof(struct __vector_file_object_t, data);
+}
+
+#endif /* VECTOR_FILE_C */
@@ -0,0 +1,316 @@
+/**
+ * @file header/vector/file.h
+ *
+ * A file is an allocator that places a vector, with its header, in a shared
+ * memory mapping of a file, such that the vector persists in the file after
+ * it's deleted and is mapped back in by reopening the file. Reopening a file
+ * maps it rather than reading it, so that a vector of many gigabytes is
+ * usable right away with its pages read in on demand:
+ *
+ * @code{.c}
+ *   static struct vector_file file;
+ *
+ *   vector_on(int) vector = vector_file_open(&file, "vector.bin", int);
+ *   if (vector_length(vector) == 0)
+ *     vector = build(vector);
+ *   ...
+ *   vector_file_sync(vector);
+ *   vector_delete(vector);
+ * @endcode
+ *
+ * A file holds a single vector. The growth of the vector extends the file with
+ * ftruncate() and remaps it, where mremap() is available (on Linux) without
+ * moving its pages. vector_delete() unmaps the vector and closes the file, and
+ * vector_file_sync() writes the vector to the file before that. The file is
+ * in the native layout of the machine and the compiler, so it can't be moved
+ * to a machine with a different one, and it mustn't be opened more than once
+ * at a time.
+ *
+ * The file can equally be a shared memory object from memfd_create() or
+ * shm_open(), which vector_file_open_fd() builds a vector in. Any number of
+ * other processes can then attach to the vector with vector_file_attach(),
+ * which maps it read-only at the cost of a single mmap() and shares its pages
+ * rather than copying them:
+ *
+ * @code{.c}
+ *   // in the process that builds the vector
+ *   int fd = memfd_create("reference", MFD_CLOEXEC);
+ *   vector_on(int) vector = vector_file_open_fd(&file, fd, int);
+ *   vector = build(vector);
+ *
+ *   // in each process that the descriptor is passed or inherited to
+ *   vector_on(const int) reference = vector_file_attach(&file, fd, int);
+ *   vector_length(reference), reference[i];
+ *   vector_file_detach(reference);
+ * @endcode
+ *
+ * The operations in this module make system calls that aren't available in
+ * strictly conforming C and so are never inlined.
+ */
+
+#ifndef VECTOR_FILE_H
+#define VECTOR_FILE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h"
+#include "allocator.h"
+
+/// @cond INTERNAL
+
+/// The magic number at the start of a file of a vector
+#define __VECTOR_FILE_MAGIC UINT64_C(0x31454c4946434556)
+
+/// The header of the mapping of a file of a vector
+struct __vector_file_object_t {
+  /// The magic number ::__VECTOR_FILE_MAGIC
+  uint64_t magic;
+  /// The size of the elements of the vector
+  size_t z;
+  _Alignas(max_align_t) char data[];
+};
+
+/// @endcond
+
+/// An allocator that places a vector in a memory mapping of a file
+struct vector_file {
+  /// The allocator of the vector in this file
+  struct vector_allocator allocator;
+  /// The file descriptor of the file or -1 if it's closed
+  int fd;
+  /// The size of the elements of the vector in the file
+  size_t z;
+  /// The length in bytes of the mapping of the file or zero
+  size_t mapping;
+  /// Whether the vector in the file is attached by vector_file_attach()
+  _Bool readonly;
+};
+
+/**
+ * @brief Open the vector of element type @a type in the file at @a path with
+ *   the @a file
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_file file;
+ *   vector_on(int) vector = vector_file_open(&file, "vector.bin", int);
+ * @endcode
+ *
+ * This is vector_file_open_z() with the size of @a type as the element size.
+ *
+ * @param file the file to open
+ * @param path the path of the file
+ * @param type a complete object type
+ * @return the vector in the file on success; otherwise @c NULL
+ *
+ * @see vector_file_open_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_file_open(struct vector_file *file, const char *path, type)
+#define vector_file_open(file, path, type) \
+  ((vector_on(type)) vector_file_open_z((file), (path), sizeof(type)))
+
+/**
+ * @brief Open the vector of element size @a z in the file at @a path with the
+ *   @a file
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_file file;
+ *   vector_on(int) vector =
+ *     vector_file_open_z(&file, "vector.bin", sizeof(int));
+ * @endcode
+ *
+ * If the file doesn't exist or is empty then this creates a vector with zero
+ * @length and @volume in it. Otherwise this maps the vector that's already in
+ * the file, which takes the same time regardless of the size of the vector.
+ * Either way the vector is allocated by the @a file, which must remain valid
+ * until the vector is deleted.
+ *
+ * If the file isn't a file of a vector or its vector has an element size other
+ * than @a z, this returns @c NULL with @c errno set to @c EINVAL. On any other
+ * failure the value of @c errno set by open(), ftruncate(), or mmap() will be
+ * retained.
+ *
+ * @param file the file to open
+ * @param path the path of the file
+ * @param z the element size of the vector
+ * @return the vector in the file on success; otherwise @c NULL
+ *
+ * @see vector_file_open() - the implicit analogue to this operation
+ */
+vector_t vector_file_open_z(
+    struct vector_file *file, const char *path, size_t z)
+  __attribute__((nonnull, warn_unused_result));
+
+/**
+ * @brief Open the vector of element type @a type in the file at the
+ *   descriptor @a fd with the @a file
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_file file;
+ *   int fd = memfd_create("vector", MFD_CLOEXEC);
+ *   vector_on(int) vector = vector_file_open_fd(&file, fd, int);
+ * @endcode
+ *
+ * This is vector_file_open_fd_z() with the size of @a type as the element
+ * size.
+ *
+ * @param file the file to open
+ * @param fd the descriptor of the file
+ * @param type a complete object type
+ * @return the vector in the file on success; otherwise @c NULL
+ *
+ * @see vector_file_open_fd_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_file_open_fd(struct vector_file *file, int fd, type)
+#define vector_file_open_fd(file, fd, type) \
+  ((vector_on(type)) vector_file_open_fd_z((file), (fd), sizeof(type)))
+
+/**
+ * @brief Open the vector of element size @a z in the file at the descriptor
+ *   @a fd with the @a file
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_file file;
+ *   int fd = memfd_create("vector", MFD_CLOEXEC);
+ *   vector_on(int) vector = vector_file_open_fd_z(&file, fd, sizeof(int));
+ * @endcode
+ *
+ * This is vector_file_open_z() except that the file is the one that @a fd,
+ * which must be open for reading and writing, refers to. The @a file uses a
+ * duplicate of @a fd, so @a fd remains open after the vector is deleted, such
+ * as to be passed to other processes that attach to the vector.
+ *
+ * On failure the value of @c errno set by fcntl(), ftruncate(), or mmap()
+ * will be retained.
+ *
+ * @param file the file to open
+ * @param fd the descriptor of the file
+ * @param z the element size of the vector
+ * @return the vector in the file on success; otherwise @c NULL
+ *
+ * @see vector_file_open_fd() - the implicit analogue to this operation
+ */
+vector_t vector_file_open_fd_z(struct vector_file *file, int fd, size_t z)
+  __attribute__((nonnull, warn_unused_result));
+
+/**
+ * @brief Attach to the vector of element type @a type in the file at the
+ *   descriptor @a fd read-only with the @a file
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_file file;
+ *   vector_on(const int) vector = vector_file_attach(&file, fd, int);
+ * @endcode
+ *
+ * This is vector_file_attach_z() with the size of @a type as the element size.
+ *
+ * @param file the file to attach with
+ * @param fd the descriptor of the file
+ * @param type a complete object type
+ * @return the vector in the file on success; otherwise @c NULL
+ *
+ * @see vector_file_attach_z() - the explicit analogue to this operation
+ */
+//= vector_c vector_file_attach(struct vector_file *file, int fd, type)
+#define vector_file_attach(file, fd, type) \
+  ((vector_on(const type)) vector_file_attach_z((file), (fd), sizeof(type)))
+
+/**
+ * @brief Attach to the vector of element size @a z in the file at the
+ *   descriptor @a fd read-only with the @a file
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_file file;
+ *   vector_c vector = vector_file_attach_z(&file, fd, sizeof(int));
+ * @endcode
+ *
+ * This maps the vector that's already in the file that @a fd refers to, which
+ * need only be open for reading, without copying it. The pages of the vector
+ * are shared with each other process that maps the file, except for the page
+ * of its header. The vector must not be modified, as it's mapped without write
+ * access, and it's deleted by vector_file_detach(). It reflects the file at
+ * the time that it's attached, so the file shouldn't be modified after that.
+ * The @a file uses a duplicate of @a fd.
+ *
+ * If the file is empty, isn't a file of a vector, or its vector has an element
+ * size other than @a z, this returns @c NULL with @c errno set to @c EINVAL.
+ * On any other failure the value of @c errno set by fcntl() or mmap() will be
+ * retained. An operation that would reallocate the vector fails with @c errno
+ * set to @c EPERM.
+ *
+ * @param file the file to attach with
+ * @param fd the descriptor of the file
+ * @param z the element size of the vector
+ * @return the vector in the file on success; otherwise @c NULL
+ *
+ * @see vector_file_attach() - the implicit analogue to this operation
+ */
+vector_c vector_file_attach_z(struct vector_file *file, int fd, size_t z)
+  __attribute__((nonnull, warn_unused_result));
+
+/**
+ * @brief Unmap the @a vector that's attached by vector_file_attach(), close its
+ *   file, and return @c NULL
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(const int) vector = vector_file_attach(&file, fd, int);
+ *   ...
+ *   vector = vector_file_detach(vector);
+ * @endcode
+ *
+ * This is vector_delete() for the @c const @a vector. If the @a vector isn't
+ * attached by vector_file_attach() then the behavior is undefined.
+ *
+ * @param vector the attached vector to detach
+ * @return @c NULL
+ */
+void *vector_file_detach(vector_c vector) __attribute__((nonnull));
+
+/**
+ * @brief Write the @a vector in a file to the file
+ *
+ * @par Example
+ * @code{.c}
+ *   vector = vector_append(vector, &value);
+ *   vector_file_sync(vector);
+ * @endcode
+ *
+ * This blocks until the modifications to the @a vector, and to the size of its
+ * file, are written to the storage device with msync() and fsync(). Without
+ * it they're written back by the system at some later point. If the @a vector
+ * isn't in a file then the behavior is undefined.
+ *
+ * On failure the value of @c errno set by msync() or fsync() will be retained.
+ *
+ * @param vector the vector in a file to write
+ * @return zero on success; otherwise -1
+ */
+int vector_file_sync(vector_c vector) __attribute__((nonnull));
+
+/// @cond INTERNAL
+
+/// Allocate an object of @a size bytes in the file at @a data
+void *__vector_file_allocate(size_t size, void *data)
+  __attribute__((nonnull, warn_unused_result));
+
+/// Resize the @a object to @a size bytes in the file at @a data
+void *__vector_file_reallocate(void *object, size_t size, void *data)
+  __attribute__((nonnull, warn_unused_result));
+
+/// Unmap the @a object and close the file at @a data
+void __vector_file_deallocate(void *object, void *data)
+  __attribute__((nonnull));
+
+/// Return the number of bytes that the @a object can use in the file at @a data
+size_t __vector_file_usable(void *object, void *data)
+  __attribute__((nonnull, pure));
+
+/// @endcond
+
+#endif /* VECTOR_FILE_H */
@@ -0,0 +1,142 @@
+/// @file header/vector/gap.c
+
+#ifndef VECTOR_GAP_C
+#define VECTOR_GAP_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "common.h"
+#include "gap.h"
+#include "access.h"
+#include "policy.h"
+#include "resize.h"
+#include "share.h"
+
+__vector_inline__
+int vector_gap_begin_z(struct vector_gap *gap, vector_t vector, size_t z) {
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return -1;
+
+  gap->vector = vector;
+  gap->z = z;
+  gap->index = vector_length(vector);
+  gap->size = 0;
+  return 0;
+}
+
+__vector_inline__ size_t vector_gap_length(const struct vector_gap *gap) {
+  return vector_length(gap->vector) - gap->size;
+}
+
+__vector_inline__ void *vector_gap_at(const struct vector_gap *gap, size_t i) {
+  if (i >= gap->index)
+    i += gap->size;
+  return vector_at(gap->vector, i, gap->z);
+}
+
+__vector_inline__ int vector_gap_insert(
+    struct vector_gap *restrict gap, size_t i, const void *restrict elmt) {
+  return vector_gap_inject(gap, i, elmt, 1);
+}
+
+__vector_inline__ int vector_gap_inject(
+    struct vector_gap *restrict gap,
+    size_t i,
+    const void *restrict elmt,
+    size_t n) {
+  size_t z = gap->z;
+
+  __vector_gap_open(gap);
+  if (n > gap->size) {
+    size_t length = vector_gap_length(gap);
+    size_t volume;
+    vector_t resize = NULL;
+
+    if (__builtin_add_overflow(length, n, &length))
+      return errno = ENOMEM, -1;
+
+    // if the volume doesn't overflow then attempt to allocate it, and
+    // otherwise just the length
+    if ((volume = __vector_policy_grow(length, z)) > length)
+      resize = vector_resize_z(gap->vector, volume, z);
+    if (resize == NULL) {
+      volume = length;
+      if ((resize = vector_resize_z(gap->vector, volume, z)) == NULL)
+        return -1;
+    }
+
+    // move the elements after the gap to the end of the volume, such that the
+    // gap is the whole of the volume that's unused
+    size_t tail = vector_length(resize) - gap->index - gap->size;
+    void *target = vector_at(resize, volume - tail, z);
+    void *source = vector_at(resize, gap->index + gap->size, z);
+    memmove(target, source, tail * z);
+
+    gap->vector = resize;
+    gap->size = volume - vector_length(resize) + gap->size;
+    __vector_to_header(resize)->length = volume;
+  }
+
+  __vector_gap_move(gap, i);
+  if (elmt != NULL)
+    memcpy(vector_at(gap->vector, i, z), elmt, n * z);
+  gap->index += n;
+  gap->size -= n;
+  return 0;
+}
+
+__vector_inline__
+void vector_gap_excise(struct vector_gap *gap, size_t i, size_t n) {
+  __vector_gap_open(gap);
+  __vector_gap_move(gap, i);
+  gap->size += n;
+}
+
+__vector_inline__ vector_t vector_gap_materialize(struct vector_gap *gap) {
+  size_t z = gap->z;
+  size_t length = vector_gap_length(gap);
+
+  if (gap->size == 0)
+    return gap->vector;
+
+  // move the elements after the gap to close it; the gap is then reopened at
+  // the tail of the vector
+  void *target = vector_at(gap->vector, gap->index, z);
+  void *source = vector_at(gap->vector, gap->index + gap->size, z);
+  memmove(target, source, (length - gap->index) * z);
+
+  __vector_to_header(gap->vector)->length = length;
+  gap->index = length;
+  gap->size = 0;
+  return gap->vector;
+}
+
+__vector_inline__ void __vector_gap_open(struct vector_gap *gap) {
+  struct __vector_header_t *header = __vector_to_header(gap->vector);
+
+  // the length of the vector includes the gap while it's open, which is at the
+  // tail of the vector when it's closed; the empty vector is read-only but it
+  // has no volume to open the gap over
+  if (header->volume != header->length) {
+    gap->size += header->volume - header->length;
+    header->length = header->volume;
+  }
+}
+
+__vector_inline__ void __vector_gap_move(struct vector_gap *gap, size_t i) {
+  size_t z = gap->z;
+  char *data = gap->vector;
+
+  // the elements between the gap and i are moved across the gap
+  if (i < gap->index)
+    memmove(data + (i + gap->size) * z, data + i * z, (gap->index - i) * z);
+  else if (i > gap->index) {
+    char *source = data + (gap->index + gap->size) * z;
+    memmove(data + gap->index * z, source, (i - gap->index) * z);
+  }
+  gap->index = i;
+}
+
+#endif /* VECTOR_GAP_C */
@@ -0,0 +1,245 @@
+/**
+ * @file header/vector/gap.h
+ *
+ * A gap buffer edits a vector through a gap of unused volume that's kept at
+ * the index of the last edit. An insertion or removal at the gap just fills or
+ * widens it, and moving the gap moves just the elements between its old and
+ * new index, so that a run of edits around a cursor that moves a little at a
+ * time costs an amortized constant time each rather than a move of the tail
+ * of the vector:
+ *
+ * @code{.c}
+ *   struct vector_gap gap;
+ *
+ *   vector_gap_begin(&gap, text);
+ *   for (size_t i = 0; i < n; i++)
+ *     vector_gap_insert(&gap, cursor++, &input[i]);
+ *   text = vector_gap_materialize(&gap);
+ * @endcode
+ *
+ * While the gap is open the elements of the vector are split around it, so
+ * they're accessed by vector_gap_at() rather than by their index in the
+ * vector, and the vector mustn't be operated on other than through the gap.
+ * vector_gap_materialize() closes the gap, which makes the elements of the
+ * vector contiguous again, and returns the vector. The gap can then be used
+ * for more edits, which reopen it.
+ *
+ * The gap is grown by the growth policy of the calling thread (see
+ * vector_policy_set()) to the whole of the volume that it leaves unused.
+ */
+
+#ifndef VECTOR_GAP_H
+#define VECTOR_GAP_H
+
+#include <stddef.h>
+#include "common.h"
+
+/// A gap buffer over a vector
+struct vector_gap {
+  /// The vector, with its elements split around the gap
+  vector_t vector;
+  /// The element size of the vector
+  size_t z;
+  /// The index of the gap, which is the index after the last edit
+  size_t index;
+  /// The number of elements of unused volume in the gap
+  size_t size;
+};
+
+/**
+ * @brief Begin to edit the @a vector through the @a gap
+ *
+ * @par Example
+ * @code{.c}
+ *   struct vector_gap gap;
+ *   vector_gap_begin(&gap, vector);
+ * @endcode
+ *
+ * @param gap the gap buffer to begin
+ * @param vector the vector to edit
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_gap_begin_z() - the explicit analogue to this operation
+ */
+//= int vector_gap_begin(struct vector_gap *gap, vector_t vector)
+#define vector_gap_begin(gap, v) \
+  vector_gap_begin_z((gap), (v), VECTOR_Z((v)))
+
+/**
+ * @brief Begin to edit the @a vector of element size @a z through the @a gap
+ *
+ * @par Example
+ * @code{.c}
+ *   struct vector_gap gap;
+ *   vector_gap_begin_z(&gap, vector, sizeof(int));
+ * @endcode
+ *
+ * The gap is opened at the tail of the @a vector, over its unused volume, by
+ * the first edit. The @a vector is then held by the @a gap and is invalidated,
+ * as it may be replaced by an edit, until it's returned by
+ * vector_gap_materialize().
+ *
+ * A @a vector that's shared by vector_share() is first unshared by
+ * vector_unshare_z(). If that fails then this returns -1 with the @a vector
+ * unmodified and the value of @c errno set by it retained.
+ *
+ * @param gap the gap buffer to begin
+ * @param vector the vector to edit
+ * @param z the element size of the @a vector
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_gap_begin() - the implicit analogue to this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__
+int vector_gap_begin_z(struct vector_gap *gap, vector_t vector, size_t z);
+
+/**
+ * @brief Return the number of elements in the vector of the @a gap
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_gap_begin(&gap, vector_define(int, 1, 2, 3));
+ *   // vector_gap_length(&gap) == 3
+ * @endcode
+ */
+__attribute__((nonnull, pure))
+__vector_inline__ size_t vector_gap_length(const struct vector_gap *gap);
+
+/**
+ * @brief Return a pointer to the element at index @a i in the vector of the
+ *   @a gap
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_gap_insert(&gap, 0, &(int) { 4 });
+ *   // *(int *) vector_gap_at(&gap, 0) == 4
+ * @endcode
+ *
+ * The index @a i is the index of the element once the gap is materialized. If
+ * @a i isn't an index in the vector then the behavior is undefined.
+ */
+__attribute__((nonnull, pure))
+__vector_inline__ void *vector_gap_at(const struct vector_gap *gap, size_t i);
+
+/**
+ * @brief Insert the object at @a elmt into the vector of the @a gap at index
+ *   @a i
+ *
+ * @par Example
+ * @code{.c}
+ *   for (size_t i = 0; i < n; i++)
+ *     vector_gap_insert(&gap, cursor++, &input[i]);
+ * @endcode
+ *
+ * This is vector_gap_inject() of a single element.
+ *
+ * @param gap the gap buffer to insert into
+ * @param i the index to insert the element at, or the length of the vector
+ * @param elmt a pointer to the element to insert, or @c NULL
+ * @return zero on success; otherwise -1
+ */
+__attribute__((nonnull(1), warn_unused_result))
+__vector_inline__ int vector_gap_insert(
+    struct vector_gap *restrict gap, size_t i, const void *restrict elmt);
+
+/**
+ * @brief Insert @a n elements from @a elmt into the vector of the @a gap at
+ *   index @a i
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_gap_inject(&gap, cursor, "text", 4);
+ *   cursor += 4;
+ * @endcode
+ *
+ * This moves the gap to @a i, moving the elements between its old index and
+ * @a i across it, and then fills the first @a n elements of the gap from
+ * @a elmt, or leaves them uninitialized if @a elmt is @c NULL. The gap is
+ * left at <tt>i + n</tt>.
+ *
+ * If the gap has fewer than @a n elements then the vector is first grown with
+ * vector_resize_z() to the volume that vector_ensure_z() would grow it to, and
+ * its elements after the gap are moved to the end of that volume. If the
+ * increased length of the vector would overflow a @c size_t then this will
+ * set @c errno to @c ENOMEM and fail. If the growth fails then this returns -1
+ * with the vector unmodified and the value of @c errno set by realloc()
+ * retained.
+ *
+ * If @a i is greater than the length of the vector or any of the @a n elements
+ * at @a elmt overlap with the vector then the behavior is undefined.
+ *
+ * @param gap the gap buffer to insert into
+ * @param i the index to insert the elements at, or the length of the vector
+ * @param elmt a pointer to the elements to insert, or @c NULL
+ * @param n the number of elements to insert from @a elmt
+ * @return zero on success; otherwise -1
+ */
+__attribute__((nonnull(1), warn_unused_result))
+__vector_inline__ int vector_gap_inject(
+    struct vector_gap *restrict gap,
+    size_t i,
+    const void *restrict elmt,
+    size_t n);
+
+/**
+ * @brief Remove @a n elements at index @a i from the vector of the @a gap
+ *
+ * @par Example
+ * @code{.c}
+ *   // backspace
+ *   vector_gap_excise(&gap, --cursor, 1);
+ * @endcode
+ *
+ * This moves the gap to @a i and then widens it over the @a n elements after
+ * it. The volume of the vector is never reduced.
+ *
+ * If any index from @a i to <tt>i + n</tt> isn't an index in the vector or its
+ * length then the behavior is undefined.
+ *
+ * @param gap the gap buffer to remove from
+ * @param i the index of the elements to remove
+ * @param n the number of elements to remove
+ */
+__attribute__((nonnull))
+__vector_inline__
+void vector_gap_excise(struct vector_gap *gap, size_t i, size_t n);
+
+/**
+ * @brief Close the gap of the @a gap and return its vector
+ *
+ * @par Example
+ * @code{.c}
+ *   vector = vector_gap_materialize(&gap);
+ *   vector_at(vector, i, sizeof(int));
+ * @endcode
+ *
+ * This moves the elements after the gap to close it, so the vector is an
+ * ordinary vector with the elements at the indices that vector_gap_at() gave
+ * them. The volume of the vector is retained. The @a gap remains in use and
+ * a subsequent edit through it reopens the gap, which invalidates the
+ * returned vector.
+ *
+ * @param gap the gap buffer to materialize
+ * @return the vector of the @a gap
+ */
+__attribute__((nonnull, returns_nonnull))
+__vector_inline__ vector_t vector_gap_materialize(struct vector_gap *gap);
+
+/// @cond INTERNAL
+
+/// Widen the gap of the @a gap over the unused volume of its vector
+__attribute__((nonnull))
+__vector_inline__ void __vector_gap_open(struct vector_gap *gap);
+
+/// Move the gap of the @a gap to index @a i
+__attribute__((nonnull))
+__vector_inline__ void __vector_gap_move(struct vector_gap *gap, size_t i);
+
+/// @endcond
+
+#endif /* VECTOR_GAP_H */
+
+#if (-1- __vector_inline__ -1)
+#include "gap.c"
+#endif /* __vector_inline__ */
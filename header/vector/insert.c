@@ -11,6 +11,8 @@
 #include "insert.h"
 #include "access.h"
 #include "resize.h"
+#include "share.h"
+#include "policy.h"
 
 __vector_inline__ vector_t vector_insert_z(
     restrict vector_t vector, size_t i, const void *restrict elmt, size_t z) {
@@ -28,7 +30,13 @@ __vector_inline__ vector_t vector_inject_z(
   if (__builtin_add_overflow(length, n, &length))
     return errno = ENOMEM, NULL;
 
-  if ((vector = vector_ensure_z(vector, length, z)) == NULL)
+  // a growth moves a shared vector to an allocation of its own, which
+  // otherwise is unshared
+  if (length > vector_volume(vector))
+    vector = vector_ensure_z(vector, length, z);
+  else
+    vector = vector_unshare_z(vector, z);
+  if (vector == NULL)
     return NULL;
 
   // move the existing elements n elements toward the tail
@@ -41,7 +49,82 @@ __vector_inline__ vector_t vector_inject_z(
     memcpy(vector_at(vector, i, z), elmt, n * z);
 
   // increase the length
-  __vector_to_header(vector)->length = length;
+  __vector_set_length(vector, length);
+
+  return vector;
+}
+
+__vector_inline__ vector_t vector_inject_zeroed_z(
+    vector_t vector, size_t i, size_t n, size_t z) {
+  size_t length = vector_length(vector), grown;
+  _Bool zeroed = 0;
+
+  if (__builtin_add_overflow(length, n, &grown))
+    return errno = ENOMEM, NULL;
+
+  // grow into zeroed space, with preallocation as in vector_ensure_z(), so the
+  // appended elements are already zero
+  if (grown > vector_volume(vector)) {
+    size_t volume = __vector_policy_grow(grown, z);
+    vector_t resize = NULL;
+    if (volume > grown)
+      resize = vector_resize_zeroed_z(vector, volume, z);
+    if (resize == NULL
+        && (resize = vector_resize_zeroed_z(vector, grown, z)) == NULL)
+      return NULL;
+    vector = resize;
+    zeroed = 1;
+  } else if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return NULL;
+
+  // move the existing elements n elements toward the tail
+  void *target = vector_at(vector, i + n, z);
+  void *source = vector_at(vector, i + 0, z);
+  memmove(target, source, (length - i) * z);
+
+  if (!zeroed || i != length)
+    memset(vector_at(vector, i, z), 0, n * z);
+
+  // increase the length
+  __vector_set_length(vector, grown);
+
+  return vector;
+}
+
+__vector_inline__ vector_t vector_inject_many_z(
+    vector_t vector,
+    const size_t *positions,
+    const void *restrict elmt,
+    size_t k,
+    size_t z) {
+  size_t length = vector_length(vector), grown;
+
+  if (__builtin_add_overflow(length, k, &grown))
+    return errno = ENOMEM, NULL;
+
+  if (grown > vector_volume(vector))
+    vector = vector_ensure_z(vector, grown, z);
+  else
+    vector = vector_unshare_z(vector, z);
+  if (vector == NULL)
+    return NULL;
+
+  // from the tail toward the head, move the elements from each index to the
+  // next toward the tail by the number of elements inserted before them, and
+  // then insert the element at that index before them
+  char *data = vector;
+  const char *source = elmt;
+  size_t end = length;
+  for (size_t j = k; j-- > 0; ) {
+    size_t i = positions[j];
+    memmove(data + (i + j + 1) * z, data + i * z, (end - i) * z);
+    if (source != NULL)
+      memcpy(data + (i + j) * z, source + j * z, z);
+    end = i;
+  }
+
+  // increase the length
+  __vector_set_length(vector, grown);
 
   return vector;
 }
@@ -56,4 +139,16 @@ __vector_inline__ vector_t vector_extend_z(
   return vector_inject_z(vector, vector_length(vector), elmt, n, z);
 }
 
+__vector_inline__
+void *vector_emplace_back_z(vector_t *vector, size_t n, size_t z) {
+  size_t length = vector_length(*vector);
+  vector_t extend;
+
+  if ((extend = vector_extend_z(*vector, NULL, n, z)) == NULL)
+    return NULL;
+
+  *vector = extend;
+  return (char *) extend + length * z;
+}
+
 #endif /* VECTOR_INSERT_C */
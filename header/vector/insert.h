@@ -97,6 +97,8 @@
  * vector_ensure_z() on the @a vector with the resultant length. If that call
  * fails then this operation will fail, with the @a vector unmodified and the
  * value of @c errno set by realloc() retained.
+ * A @a vector that's shared by vector_share() is unshared by that growth, or
+ * otherwise first by vector_unshare_z(), which can fail in the same way.
  *
  * Before the object at @a elmt is copied into the @a vector, each element at
  * index @a i or greater is displaced by one toward the tail of the @a vector,
@@ -222,6 +224,8 @@ __vector_inline__ vector_t vector_insert_z(
  * vector_ensure_z() on the @a vector with the resultant length. If that call
  * fails then this operation will fail, with the @a vector unmodified and the
  * value of @c errno set by realloc() retained.
+ * A @a vector that's shared by vector_share() is unshared by that growth, or
+ * otherwise first by vector_unshare_z(), which can fail in the same way.
  *
  * Before the @a n elements at @a elmt are copied into the @a vector, each
  * element at index @a i or greater is displaced by @a n toward the tail of the
@@ -265,6 +269,140 @@ __vector_inline__ vector_t vector_inject_z(
     size_t z)
   __attribute__((nonnull(1), warn_unused_result));
 
+/**
+ * @brief Insert @a n zeroed elements into the @a vector at index @a i
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2);
+ *   vector = vector_inject_zeroed(vector, 1, 2);
+ *   // vector ≡ [1, 0, 0, 2]
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector to insert the elements, or its length
+ * @param n the number of elements to insert
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_inject_zeroed_z() - the explicit analogue of this operation
+ */
+//= vector_t vector_inject_zeroed(vector_t vector, size_t i, size_t n)
+#define vector_inject_zeroed(v, ...) \
+  vector_inject_zeroed_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Insert @a n zeroed elements into the @a vector at index @a i
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2);
+ *   vector = vector_inject_zeroed_z(vector, 1, 2, sizeof(int));
+ *   // vector ≡ [1, 0, 0, 2]
+ * @endcode
+ *
+ * This is vector_inject_z() with each bit of each inserted element zero, as
+ * for a zero-initialized counter, instead of elements from a buffer. Where the
+ * @a vector has to grow, it grows as by vector_resize_zeroed_z() so that the
+ * elements appended to it from a fresh allocation of calloc() aren't written
+ * at all. Otherwise the inserted elements are zeroed with memset().
+ *
+ * If the increased length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and fail. If the growth of the @a vector fails
+ * then this will fail with the @a vector unmodified and the value of @c errno
+ * set by calloc() or realloc() retained.
+ *
+ * If @a i is greater than the length of the @a vector then the behavior is
+ * undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector to insert the elements, or its length
+ * @param n the number of elements to insert
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_inject_zeroed() - the implicit analogue of this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_inject_zeroed_z(
+    vector_t vector, size_t i, size_t n, size_t z);
+
+/**
+ * @brief Insert the @a k elements from @a elmt into the @a vector, each at the
+ *   index in @a positions of the same index
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 3, 5);
+ *   vector = vector_inject_many(vector, (size_t[]) { 0, 2, 3 },
+ *       &(int[]) { 0, 4, 6 }, 3);
+ *   // vector ≡ [0, 1, 3, 4, 5, 6]
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param positions the indices in the @a vector to insert the elements before
+ * @param elmt a pointer to the elements to insert, or @c NULL
+ * @param k the number of elements to insert from @a elmt
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_inject_many_z() - the explicit analogue of this operation
+ */
+//= vector_t vector_inject_many(
+//=   vector_t vector, const size_t *positions, const void *elmt, size_t k)
+#define vector_inject_many(v, ...) \
+  vector_inject_many_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Insert the @a k elements from @a elmt into the @a vector, each at the
+ *   index in @a positions of the same index
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 3, 5);
+ *   vector = vector_inject_many_z(vector, (size_t[]) { 0, 2, 3 },
+ *       &(int[]) { 0, 4, 6 }, 3, sizeof(int));
+ *   // vector ≡ [0, 1, 3, 4, 5, 6]
+ * @endcode
+ *
+ * Each index in @a positions is an index in the @a vector as it is before this
+ * operation, or its length, and the element at the same index in @a elmt is
+ * inserted before the element at that index, or appended. Elements with the
+ * same index are inserted in their order in @a elmt. If @a elmt is @c NULL then
+ * the inserted elements will be uninitialized.
+ *
+ * This is more efficient than @a k separate calls to vector_insert_z(), which
+ * each move each element after the index. The @a vector is grown once, with
+ * vector_ensure_z(), and then each element is moved at most once, from the
+ * tail of the @a vector toward its head, to its index after the elements
+ * inserted before it.
+ *
+ * If the increased length of the @a vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and fail. If vector_ensure_z() fails, or a
+ * @a vector that's shared by vector_share() fails to be unshared by
+ * vector_unshare_z(), then this will fail with the @a vector unmodified and the
+ * value of @c errno set by realloc() retained.
+ *
+ * If the @a k indices in @a positions aren't in ascending order, or any of
+ * them is greater than the length of the @a vector, then the behavior is
+ * undefined. If any of the @a k elements at @a elmt overlap with the @a vector
+ * then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param positions the indices in the @a vector to insert the elements before
+ * @param elmt a pointer to the elements to insert, or @c NULL
+ * @param k the number of elements to insert from @a elmt
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_inject_many() - the implicit analogue of this operation
+ */
+__attribute__((nonnull(1, 2), warn_unused_result))
+__vector_inline__ vector_t vector_inject_many_z(
+    vector_t vector,
+    const size_t *positions,
+    const void *restrict elmt,
+    size_t k,
+    size_t z);
+
 /**
  * @brief Insert the object at @a elmt as the last element in the @a vector
  *
@@ -338,6 +476,8 @@ __vector_inline__ vector_t vector_inject_z(
  * vector_ensure_z() on the @a vector with the resultant length. If that call
  * fails then this operation will fail, with the @a vector unmodified and the
  * value of @c errno set by realloc() retained.
+ * A @a vector that's shared by vector_share() is unshared by that growth, or
+ * otherwise first by vector_unshare_z(), which can fail in the same way.
  *
  * If @a elmt is @c NULL then the appended element will be uninitialized.
  *
@@ -450,6 +590,8 @@ __vector_inline__ vector_t vector_append_z(
  * vector_ensure_z() on the @a vector with the resultant length. If that call
  * fails then this operation will fail, with the @a vector unmodified and the
  * value of @c errno set by realloc() retained.
+ * A @a vector that's shared by vector_share() is unshared by that growth, or
+ * otherwise first by vector_unshare_z(), which can fail in the same way.
  *
  * If @a elmt is @c NULL then the appended elements will be uninitialized.
  *
@@ -481,6 +623,94 @@ __vector_inline__ vector_t vector_extend_z(
     restrict vector_t vector, const void *restrict elmt, size_t n, size_t z)
   __attribute__((nonnull(1), warn_unused_result));
 
+/**
+ * @brief Append @a n uninitialized elements to the tail of the vector at
+ *   @a vp and return a pointer to the first of them
+ *
+ * @par Example
+ * @code{.c}
+ *   struct record *record = vector_emplace_back(&records, 1);
+ *   if (record == NULL)
+ *     return -1;
+ *   record->id = id;
+ * @endcode
+ *
+ * This is vector_extend() with @a elmt @c NULL, except that the resultant
+ * vector is stored at @a vp and a pointer to the appended elements is
+ * returned, so that they're constructed in place rather than copied from
+ * elsewhere. The @length of the vector is already increased by @a n. The
+ * pointer is of the type of the vector, and is valid until the next operation
+ * that may resize the vector.
+ *
+ * If the operation fails then this returns @c NULL, with the vector at @a vp
+ * unmodified.
+ *
+ * @param vp a pointer to the vector to operate on
+ * @param n the number of elements to append
+ * @return a pointer to the appended elements on success; otherwise @c NULL
+ *
+ * @see vector_emplace_back_z() - the explicit analogue to this operation
+ */
+//= void *vector_emplace_back(vector_t *vp, size_t n)
+#define vector_emplace_back(vp, n) \
+  ({ \
+    __typeof__(vp) __vp = (vp); \
+    vector_t __vector = *__vp; \
+    __typeof__(*__vp) __elmt = \
+      vector_emplace_back_z(&__vector, (n), VECTOR_Z(*__vp)); \
+    *__vp = __vector; \
+    __elmt; \
+  })
+
+/**
+ * @brief Append @a n uninitialized elements to the tail of the vector at
+ *   @a vector and return a pointer to the first of them
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_t records = vector_create();
+ *   struct record *record;
+ *
+ *   record = vector_emplace_back_z(&records, 1, sizeof(struct record));
+ *   if (record == NULL)
+ *     return -1;
+ *   record->id = id;
+ * @endcode
+ *
+ * This is vector_extend_z() with @a elmt @c NULL, except that the resultant
+ * vector is stored at @a vector and a pointer to the appended elements is
+ * returned, so that they're constructed in place rather than copied from
+ * elsewhere. The @length of the vector is already increased by @a n. The
+ * pointer is valid until the next operation that may resize the vector.
+ *
+ * If the increased length of the vector would overflow a @c size_t then this
+ * will set @c errno to @c ENOMEM and fail. Otherwise, this will call
+ * vector_ensure_z() on the vector with the resultant length. If that call
+ * fails then this operation will fail, with the vector at @a vector
+ * unmodified and the value of @c errno set by realloc() retained.
+ * A vector that's shared by vector_share() is unshared by that growth, or
+ * otherwise first by vector_unshare_z(), which can fail in the same way.
+ *
+ * @warning @parblock The behavior of this operation is undefined when:
+ *
+ *   - @a z isn't the element size of the vector
+ *
+ *   A successful call to this operation will replace the vector at @a vector
+ *   and any subsequent access to, or operation on, the original vector is
+ *   undefined behavior.
+ * @endparblock
+ *
+ * @param vector a pointer to the vector to operate on
+ * @param n the number of elements to append
+ * @param z the element size of the vector
+ * @return a pointer to the appended elements on success; otherwise @c NULL
+ *
+ * @see vector_emplace_back() - the implicit analogue to this operation
+ */
+__vector_inline__
+void *vector_emplace_back_z(vector_t *vector, size_t n, size_t z)
+  __attribute__((nonnull, warn_unused_result));
+
 #endif /* VECTOR_INSERT_H */
 
 #if (-1- __vector_inline__ -1)
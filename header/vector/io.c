@@ -0,0 +1,161 @@
+/// @file header/vector/io.c
+
+#ifndef VECTOR_IO_C
+#define VECTOR_IO_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "io.h"
+#include "access.h"
+#include "create.h"
+#include "delete.h"
+
+/// The most bytes that are passed to a single call of writev() or read()
+#define __VECTOR_IO_CHUNK ((size_t) 1 << 30)
+
+int vector_write_fd_z(vector_c vector, int fd, size_t z) {
+  struct __vector_io_header_t header;
+  size_t size = vector_length(vector) * z;
+
+  memcpy(header.magic, __VECTOR_IO_MAGIC, sizeof(header.magic));
+  header.version = __VECTOR_IO_VERSION;
+  header.order = __VECTOR_IO_ORDER;
+  header.z = z;
+  header.length = vector_length(vector);
+  header.checksum = __vector_io_checksum(vector, size);
+
+  struct iovec iov[2] = {
+    { .iov_base = &header, .iov_len = sizeof(header) },
+    // writev() just reads from the data, which it can't declare as const
+    { .iov_base = (void *) (uintptr_t) vector, .iov_len = size },
+  };
+  struct iovec *next = iov;
+  int count = 2;
+
+  while (count != 0) {
+    // the data is written in chunks that don't overflow the result of writev()
+    size_t rest = next[count - 1].iov_len;
+    if (rest > __VECTOR_IO_CHUNK)
+      next[count - 1].iov_len = __VECTOR_IO_CHUNK;
+
+    ssize_t written = writev(fd, next, count);
+    next[count - 1].iov_len = rest;
+    if (written < 0 && errno == EINTR)
+      continue;
+    if (written < 0)
+      return -1;
+
+    // skip the buffers that were written in whole then the part of the next
+    size_t n = (size_t) written;
+    for (; count != 0 && n >= next->iov_len; next++, count--)
+      n -= next->iov_len;
+    if (count != 0) {
+      next->iov_base = (char *) next->iov_base + n;
+      next->iov_len -= n;
+    }
+  }
+
+  return 0;
+}
+
+/**
+ * Read exactly @a size bytes from @a fd into @a data. Return zero on success
+ * and -1 with @c errno set to @c EBADMSG if @a fd ends before that.
+ */
+static int __vector_io_read(int fd, void *data, size_t size) {
+  char *next = data;
+
+  while (size != 0) {
+    ssize_t n = read(fd, next,
+        size < __VECTOR_IO_CHUNK ? size : __VECTOR_IO_CHUNK);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n < 0)
+      return -1;
+    if (n == 0)
+      return errno = EBADMSG, -1;
+    next += n;
+    size -= (size_t) n;
+  }
+
+  return 0;
+}
+
+vector_t vector_read_fd_z(int fd, size_t z) {
+  struct __vector_io_header_t header;
+  vector_t vector;
+  size_t size;
+  int error;
+
+  if (__vector_io_read(fd, &header, sizeof(header)) != 0)
+    return NULL;
+
+  if (memcmp(header.magic, __VECTOR_IO_MAGIC, sizeof(header.magic)) != 0
+      || header.version != __VECTOR_IO_VERSION
+      || header.order != __VECTOR_IO_ORDER
+      || header.z != z
+      || (size_t) header.length != header.length)
+    return errno = EINVAL, NULL;
+  if (__builtin_mul_overflow((size_t) header.length, z, &size))
+    return errno = ENOMEM, NULL;
+
+  // the data is read straight into the volume of the vector
+  if ((vector = vector_create_with_z((size_t) header.length, z)) == NULL)
+    return NULL;
+  if (__vector_io_read(fd, vector, size) != 0)
+    goto fail;
+  if (__vector_io_checksum(vector, size) != header.checksum) {
+    errno = EBADMSG;
+    goto fail;
+  }
+
+  if (header.length != 0)
+    __vector_to_header(vector)->length = (size_t) header.length;
+  return vector;
+
+fail:
+  error = errno;
+  vector_delete(vector);
+  errno = error;
+  return NULL;
+}
+
+uint64_t __vector_io_checksum(const void *data, size_t size) {
+  static const uint64_t prime = UINT64_C(0x9e3779b97f4a7c15);
+  const unsigned char *bytes = data;
+  uint64_t lane[4] = { size, ~size, prime, ~prime };
+  uint64_t word;
+
+  // four independent lanes of 8 bytes each, mixed by a multiplication and a
+  // shift, keep the multiplier busy at about the speed of memory
+  for (; size >= sizeof(lane); bytes += sizeof(lane), size -= sizeof(lane)) {
+    for (int i = 0; i < 4; i++) {
+      memcpy(&word, bytes + i * sizeof(word), sizeof(word));
+      lane[i] = (lane[i] ^ word) * prime;
+      lane[i] ^= lane[i] >> 29;
+    }
+  }
+
+  // the remaining bytes are mixed into the lanes in turn, zero padded
+  for (int i = 0; size != 0; i = (i + 1) % 4) {
+    size_t n = size < sizeof(word) ? size : sizeof(word);
+    word = 0;
+    memcpy(&word, bytes, n);
+    lane[i] = (lane[i] ^ word) * prime;
+    lane[i] ^= lane[i] >> 29;
+    bytes += n, size -= n;
+  }
+
+  uint64_t sum = 0;
+  for (int i = 0; i < 4; i++)
+    sum = (sum ^ lane[i]) * prime + (uint64_t) i;
+  return sum ^ sum >> 32;
+}
+
+#endif /* VECTOR_IO_C */
@@ -0,0 +1,172 @@
+/**
+ * @file header/vector/io.h
+ *
+ * A vector is written to and read from a file descriptor in a binary format,
+ * which is a header of 40 bytes followed by the data of the vector as is:
+ *
+ * | Offset | Size | Field                                                  |
+ * | -----: | ---: | :----------------------------------------------------- |
+ * |      0 |    8 | The magic number <tt>"\x89VEC\r\n\x1a\n"</tt>          |
+ * |      8 |    4 | The version of the format, which is 1                  |
+ * |     12 |    4 | The byte order mark @c 0x01020304                      |
+ * |     16 |    8 | The element size of the vector                         |
+ * |     24 |    8 | The length of the vector                               |
+ * |     32 |    8 | The checksum of the data of the vector                 |
+ *
+ * Each field after the magic number is an unsigned integer in the byte order of
+ * the writer, which the byte order mark identifies. As the elements of the
+ * vector are opaque, a vector written on a machine of one byte order can't be
+ * read on a machine of another.
+ *
+ * @code{.c}
+ *   vector_write_fd(vector, fd);
+ *   ...
+ *   vector_on(int) copy = vector_read_fd(int, fd);
+ * @endcode
+ *
+ * vector_write_fd() writes the header and the data with a single writev() and
+ * vector_read_fd() reads the data straight into the vector it allocates, so
+ * neither copies the data through a buffer.
+ *
+ * The operations in this module make system calls that aren't available in
+ * strictly conforming C and so are never inlined.
+ */
+
+#ifndef VECTOR_IO_H
+#define VECTOR_IO_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "common.h"
+
+/// @cond INTERNAL
+
+/// The magic number at the start of a written vector
+#define __VECTOR_IO_MAGIC "\x89VEC\r\n\x1a\n"
+
+/// The version of the format of a written vector
+#define __VECTOR_IO_VERSION 1
+
+/// The byte order mark of a written vector
+#define __VECTOR_IO_ORDER UINT32_C(0x01020304)
+
+/// The header of a written vector
+struct __vector_io_header_t {
+  /// The magic number ::__VECTOR_IO_MAGIC
+  char magic[8];
+  /// The version of the format ::__VECTOR_IO_VERSION
+  uint32_t version;
+  /// The byte order mark ::__VECTOR_IO_ORDER
+  uint32_t order;
+  /// The element size of the vector
+  uint64_t z;
+  /// The length of the vector
+  uint64_t length;
+  /// The checksum of the data of the vector
+  uint64_t checksum;
+};
+
+/// @endcond
+
+/**
+ * @brief Write the @a vector to the file descriptor @a fd
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3);
+ *   vector_write_fd(vector, fd);
+ * @endcode
+ *
+ * @param vector the vector to write
+ * @param fd the file descriptor to write to
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_write_fd_z() - the explicit analogue to this operation
+ */
+//= int vector_write_fd(vector_c vector, int fd)
+#define vector_write_fd(v, ...) \
+  vector_write_fd_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Write the @a vector of element size @a z to the file descriptor
+ *   @a fd
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3);
+ *   vector_write_fd_z(vector, fd, sizeof(int));
+ * @endcode
+ *
+ * This writes the header and the data of the @a vector at the current offset
+ * of @a fd, retrying a partial write until the whole of it is written. On
+ * failure part of it may have been written and the value of @c errno set by
+ * writev() will be retained.
+ *
+ * @param vector the vector to write
+ * @param fd the file descriptor to write to
+ * @param z the element size of the vector
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_write_fd() - the implicit analogue to this operation
+ */
+int vector_write_fd_z(vector_c vector, int fd, size_t z)
+  __attribute__((nonnull));
+
+/**
+ * @brief Read a vector of @a type from the file descriptor @a fd
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_read_fd(int, fd);
+ * @endcode
+ *
+ * This is vector_read_fd_z() with the size of @a type as the element size.
+ *
+ * @param type a complete object type
+ * @param fd the file descriptor to read from
+ * @return the read vector of element type @a type on success; otherwise
+ *   @c NULL
+ *
+ * @see vector_read_fd_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_read_fd(type, int fd)
+#define vector_read_fd(type, ...) \
+  ((vector_on(type)) vector_read_fd_z(__VA_ARGS__, sizeof(type)))
+
+/**
+ * @brief Read a vector of element size @a z from the file descriptor @a fd
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_read_fd_z(fd, sizeof(int));
+ * @endcode
+ *
+ * This reads a vector that was written by vector_write_fd() from the current
+ * offset of @a fd into a vector that it allocates with vector_create_with()
+ * for exactly the length of the vector. The created vector is returned and
+ * must be deleted as usual.
+ *
+ * If what's read isn't a vector of element size @a z in the byte order of this
+ * machine, this returns @c NULL with @c errno set to @c EINVAL. If @a fd ends
+ * before the end of the vector or its checksum doesn't match its data, this
+ * returns @c NULL with @c errno set to @c EBADMSG. On any other failure the
+ * value of @c errno set by read() or malloc() will be retained.
+ *
+ * @param fd the file descriptor to read from
+ * @param z the element size of the vector
+ * @return the read vector on success; otherwise @c NULL
+ *
+ * @see vector_read_fd() - the implicit analogue to this operation
+ */
+vector_t vector_read_fd_z(int fd, size_t z)
+  __attribute__((warn_unused_result));
+
+/// @cond INTERNAL
+
+/// Return the checksum of the @a size bytes at @a data
+uint64_t __vector_io_checksum(const void *data, size_t size)
+  __attribute__((pure));
+
+/// @endcond
+
+#endif /* VECTOR_IO_H */
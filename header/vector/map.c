@@ -0,0 +1,249 @@
+/// @file header/vector/map.c
+
+#ifndef VECTOR_MAP_C
+#define VECTOR_MAP_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "common.h"
+#include "map.h"
+#include "allocator.h"
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif /* MAP_ANONYMOUS */
+
+/// The size of a huge page that a huge map aligns the data of a vector to
+#define __VECTOR_MAP_HUGE ((size_t) 2 << 20)
+
+const struct vector_allocator *vector_map_init(
+    struct vector_map *map, size_t threshold) {
+  map->allocator.allocate = __vector_map_allocate;
+  map->allocator.reallocate = __vector_map_reallocate;
+  map->allocator.deallocate = __vector_map_deallocate;
+  map->allocator.usable = NULL;
+  map->allocator.data = map;
+  map->threshold = threshold;
+  map->huge = 0;
+  return &map->allocator;
+}
+
+const struct vector_allocator *vector_map_init_huge(
+    struct vector_map *map, size_t threshold) {
+  const struct vector_allocator *allocator = vector_map_init(map, threshold);
+  map->huge = 1;
+  return allocator;
+}
+
+size_t __vector_map_round(size_t size, size_t unit) {
+  if (__builtin_add_overflow(size, unit - 1, &size))
+    return 0;
+  return size - size % unit;
+}
+
+/// Return the start of the mapping that contains the object at @a header
+static char *__vector_map_start(struct __vector_map_object_t *header) {
+  size_t page = (size_t) sysconf(_SC_PAGESIZE);
+  return (char *) header - (size_t) header % page;
+}
+
+/**
+ * Calculate the @a length of the mapping of an object of @a size bytes in the
+ * @a map and the @a offset of its header from the start of that mapping.
+ * Return zero if the @a length would overflow a @c size_t.
+ *
+ * In a huge map the first page of the mapping holds just the header of the
+ * object and the header of the vector at its tail, such that the data of the
+ * vector starts on the huge page boundary right after it.
+ */
+static _Bool __vector_map_layout(
+    const struct vector_map *map, size_t size, size_t *length, size_t *offset) {
+  size_t page = (size_t) sysconf(_SC_PAGESIZE);
+  size_t front = offsetof(struct __vector_map_object_t, data);
+
+  if (!map->huge) {
+    *offset = 0;
+    if (__builtin_add_overflow(size, front, length))
+      return 0;
+    return (*length = __vector_map_round(*length, page)) != 0;
+  }
+
+  // the size of the object beyond the header of the vector
+  size_t header = offsetof(struct __vector_header_t, data);
+  size_t tail = size > header ? size - header : 0;
+
+  *offset = page - front - header;
+  if ((*length = __vector_map_round(tail, __VECTOR_MAP_HUGE)) == 0 && tail != 0)
+    return 0;
+  return !__builtin_add_overflow(*length, page, length);
+}
+
+/// Map an anonymous region of @a length bytes or return @c NULL
+static char *__vector_map_map(size_t length) {
+  void *mapping = mmap(NULL, length,
+      PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  return mapping != MAP_FAILED ? mapping : NULL;
+}
+
+/**
+ * Map an anonymous region of @a length bytes for the @a map or return @c NULL.
+ * In a huge map the region starts a page before a huge page boundary and the
+ * remainder of it is advised to be backed by huge pages.
+ */
+static char *__vector_map_reserve(const struct vector_map *map, size_t length) {
+  size_t page = (size_t) sysconf(_SC_PAGESIZE);
+  size_t huge = __VECTOR_MAP_HUGE;
+  char *mapping;
+
+  if (!map->huge)
+    return __vector_map_map(length);
+
+  // overallocate by a huge page then unmap whatever is outside of the region
+  size_t extent;
+  if (__builtin_add_overflow(length, huge, &extent))
+    return errno = ENOMEM, NULL;
+  if ((mapping = __vector_map_map(extent)) == NULL)
+    return NULL;
+
+  size_t head = (huge - ((size_t) mapping + page) % huge) % huge;
+  if (head != 0)
+    munmap(mapping, head);
+  if (extent - head - length != 0)
+    munmap(mapping + head + length, extent - head - length);
+
+  return mapping + head;
+}
+
+/**
+ * Advise that the mapping at @a start in a huge @a map be backed by huge pages.
+ * This includes the first page of the mapping as otherwise the mapping would
+ * be split into two and mremap() can't operate across that split.
+ */
+static void __vector_map_advise(
+    const struct vector_map *map, char *start, size_t length) {
+  if (!map->huge)
+    return;
+#ifdef MADV_HUGEPAGE
+  madvise(start, length, MADV_HUGEPAGE);
+#else
+  (void) start, (void) length;
+#endif /* MADV_HUGEPAGE */
+}
+
+void *__vector_map_allocate(size_t size, void *data) {
+  struct vector_map *map = data;
+  struct __vector_map_object_t *header;
+
+  size_t total;
+  if (__builtin_add_overflow(size, sizeof(*header), &total))
+    return errno = ENOMEM, NULL;
+
+  if (total < map->threshold) {
+    if ((header = malloc(total)) == NULL)
+      return NULL;
+    header->mapping = 0;
+  } else {
+    size_t length, offset;
+    char *start;
+
+    if (!__vector_map_layout(map, size, &length, &offset))
+      return errno = ENOMEM, NULL;
+    if ((start = __vector_map_reserve(map, length)) == NULL)
+      return NULL;
+    __vector_map_advise(map, start, length);
+
+    header = (struct __vector_map_object_t *) (start + offset);
+    header->mapping = length;
+  }
+
+  header->size = size;
+  return header->data;
+}
+
+void *__vector_map_reallocate(void *object, size_t size, void *data) {
+  struct vector_map *map = data;
+  struct __vector_map_object_t *header = (struct __vector_map_object_t *)
+    ((char *) object - offsetof(struct __vector_map_object_t, data));
+
+  size_t total;
+  if (__builtin_add_overflow(size, sizeof(*header), &total))
+    return errno = ENOMEM, NULL;
+
+  // when the object moves between malloc() and a mapping it must be copied
+  if ((header->mapping == 0) != (total < map->threshold)) {
+    void *result;
+    if ((result = __vector_map_allocate(size, map)) == NULL)
+      return NULL;
+    memcpy(result, object, header->size < size ? header->size : size);
+    __vector_map_deallocate(object, map);
+    return result;
+  }
+
+  if (header->mapping == 0) {
+    if ((header = realloc(header, total)) == NULL)
+      return NULL;
+    header->size = size;
+    return header->data;
+  }
+
+  size_t length, offset;
+  if (!__vector_map_layout(map, size, &length, &offset))
+    return errno = ENOMEM, NULL;
+
+  if (length != header->mapping) {
+    char *start = __vector_map_start(header);
+    char *mapping;
+
+    offset = (size_t) ((char *) header - start);
+#ifdef MREMAP_FIXED
+    if (!map->huge)
+      mapping = mremap(start, header->mapping, length, MREMAP_MAYMOVE);
+    else
+      mapping = mremap(start, header->mapping, length, 0);
+
+    // a huge mapping that can't be resized in place has its pages moved to a
+    // region with the same alignment
+    if (map->huge && mapping == MAP_FAILED) {
+      char *target;
+      if ((target = __vector_map_reserve(map, length)) == NULL)
+        return NULL;
+      mapping = mremap(start, header->mapping, length,
+          MREMAP_MAYMOVE | MREMAP_FIXED, target);
+      if (mapping == MAP_FAILED)
+        munmap(target, length);
+    }
+    if (mapping == MAP_FAILED)
+      return NULL;
+#else
+    if ((mapping = __vector_map_reserve(map, length)) == NULL)
+      return NULL;
+    memcpy(mapping, start, header->mapping < length ? header->mapping : length);
+    munmap(start, header->mapping);
+#endif /* MREMAP_FIXED */
+    __vector_map_advise(map, mapping, length);
+
+    header = (struct __vector_map_object_t *) (mapping + offset);
+    header->mapping = length;
+  }
+
+  header->size = size;
+  return header->data;
+}
+
+void __vector_map_deallocate(void *object, void *data) {
+  struct __vector_map_object_t *header = (struct __vector_map_object_t *)
+    ((char *) object - offsetof(struct __vector_map_object_t, data));
+  (void) data;
+
+  if (header->mapping == 0)
+    free(header);
+  else
+    munmap(__vector_map_start(header), header->mapping);
+}
+
+#endif /* VECTOR_MAP_C */
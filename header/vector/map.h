@@ -0,0 +1,126 @@
+/**
+ * @file header/vector/map.h
+ *
+ * A map is an allocator that places each object of at least a threshold size
+ * in its own anonymous memory mapping and uses malloc() for smaller objects.
+ * Where mremap() is available (on Linux) the reallocation of a mapped object
+ * remaps its pages rather than copying them, so that a vector of many
+ * gigabytes can grow without its elements being copied:
+ *
+ * @code{.c}
+ *   static struct vector_map map;
+ *
+ *   vector_on(char) vector = vector_create_in(vector_map_init(&map, 1 << 26));
+ *   vector = vector_ensure(vector, (size_t) 1 << 34);
+ * @endcode
+ *
+ * An object that's reallocated across the threshold is copied just once as it
+ * moves between malloc() and a mapping.
+ *
+ * A map initialized with vector_map_init_huge() instead aligns the data of
+ * each vector in a mapping to a 2 MiB huge page boundary and advises with
+ * madvise(MADV_HUGEPAGE) that the mapping be backed by transparent huge pages.
+ * The header of such a vector sits at the tail of the page right before its
+ * data. This reduces the TLB misses of random access into a large vector.
+ *
+ * The operations in this module make system calls that aren't available in
+ * strictly conforming C and, as they're only called through the allocator of
+ * a vector, are never inlined.
+ */
+
+#ifndef VECTOR_MAP_H
+#define VECTOR_MAP_H
+
+#include <stddef.h>
+#include "common.h"
+#include "allocator.h"
+
+/// @cond INTERNAL
+
+/// The header of an object that's allocated from a map
+struct __vector_map_object_t {
+  /// The size of the object in bytes
+  size_t size;
+  /// The length of the mapping of the object or zero if it's from malloc()
+  size_t mapping;
+  _Alignas(max_align_t) char data[];
+};
+
+/// @endcond
+
+/// An allocator that places large vectors in anonymous memory mappings
+struct vector_map {
+  /// The allocator to create vectors in this map with
+  struct vector_allocator allocator;
+  /// The allocation size in bytes at which an object is placed in a mapping
+  size_t threshold;
+  /// Whether the data of a vector in a mapping is aligned to a huge page
+  _Bool huge;
+};
+
+/**
+ * @brief Initialize the @a map with a @a threshold and return its allocator
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_map map;
+ *   vector_on(int) vector = vector_create_in(vector_map_init(&map, 1 << 26));
+ * @endcode
+ *
+ * Each allocation from the @a map of at least @a threshold bytes is placed in
+ * its own anonymous memory mapping. On failure the value of @c errno set by
+ * mmap(), mremap(), or malloc() will be retained.
+ *
+ * @param map the map to initialize
+ * @param threshold the allocation size in bytes at which to use a mapping
+ * @return the allocator of the @a map
+ */
+const struct vector_allocator *vector_map_init(
+    struct vector_map *map, size_t threshold)
+  __attribute__((nonnull, returns_nonnull));
+
+/**
+ * @brief Initialize the @a map with a @a threshold to use huge pages and return
+ *   its allocator
+ *
+ * @par Example
+ * @code{.c}
+ *   static struct vector_map map;
+ *   vector_on(int) vector =
+ *     vector_create_in(vector_map_init_huge(&map, 1 << 26));
+ * @endcode
+ *
+ * This is vector_map_init() except that the data of each vector in a mapping
+ * from the @a map starts on a 2 MiB boundary and the mapping is advised to be
+ * backed by transparent huge pages where madvise(MADV_HUGEPAGE) is available.
+ * This alignment is retained as the vector is reallocated. Each mapping is a
+ * multiple of 2 MiB in size, plus one page for the header of the vector.
+ *
+ * @param map the map to initialize
+ * @param threshold the allocation size in bytes at which to use a mapping
+ * @return the allocator of the @a map
+ */
+const struct vector_allocator *vector_map_init_huge(
+    struct vector_map *map, size_t threshold)
+  __attribute__((nonnull, returns_nonnull));
+
+/// @cond INTERNAL
+
+/// Return @a size rounded up to a multiple of @a unit or zero on overflow
+size_t __vector_map_round(size_t size, size_t unit) __attribute__((const));
+
+/// Allocate an object of @a size bytes from the map at @a data
+void *__vector_map_allocate(size_t size, void *data)
+  __attribute__((nonnull, warn_unused_result));
+
+/// Resize the @a object to @a size bytes in the map at @a data
+void *__vector_map_reallocate(void *object, size_t size, void *data)
+  __attribute__((nonnull, warn_unused_result));
+
+/// Deallocate the @a object in the map at @a data
+void __vector_map_deallocate(void *object, void *data)
+  __attribute__((nonnull));
+
+/// @endcond
+
+#endif /* VECTOR_MAP_H */
@@ -3,15 +3,20 @@
 #ifndef VECTOR_MOVE_C
 #define VECTOR_MOVE_C
 
+#include <assert.h>
 #include <stddef.h>
 #include <stdlib.h>
 
 #include "common.h"
 #include "move.h"
 #include "access.h"
+#include "share.h"
 
 __vector_inline__ void vector_move_z(
     vector_t vector, size_t target, size_t source, size_t z) {
+  // the other references to a shared vector would see the elements move
+  assert(!vector_shared(vector));
+
   if (target == source)
     return;
 
@@ -26,6 +31,9 @@ __vector_inline__ void vector_move_z(
 
 __vector_inline__
 void vector_swap_z(vector_t vector, size_t i, size_t j, size_t z) {
+  // the other references to a shared vector would see the elements swap
+  assert(!vector_shared(vector));
+
   char *a = vector_at(vector, i, z);
   char *b = vector_at(vector, j, z);
 
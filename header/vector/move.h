@@ -32,6 +32,9 @@
  * If either @a i or @a j isn't an index in the @a vector then the behavior of
  * this operation is undefined.
  *
+ * The @a vector mustn't be shared by vector_share(), which is asserted, as the
+ * other references to it would be modified (see vector_unshare()).
+ *
  * @param vector the vector to operate on
  * @param i the index of an element in the @a vector to swap
  * @param j the index of an element in the @a vector to swap
@@ -90,6 +93,9 @@ void vector_swap_z(vector_t vector, size_t i, size_t j, size_t z);
  * If @a target or @a source isn't an index in the @a vector then the behavior
  * is undefined.
  *
+ * The @a vector mustn't be shared by vector_share(), which is asserted, as the
+ * other references to it would be modified (see vector_unshare()).
+ *
  * @param vector the vector to operate on
  * @param target the index in the @a vector to move the element to
  * @param source the index of the element in the @a vector to move
@@ -0,0 +1,147 @@
+/// @file header/vector/policy.c
+
+#ifndef VECTOR_POLICY_C
+#define VECTOR_POLICY_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "common.h"
+#include "policy.h"
+#include "allocator.h"
+
+__vector_inline__ const struct vector_policy *vector_policy(void) {
+  return __vector_policy;
+}
+
+__vector_inline__
+const struct vector_policy *vector_policy_set(
+    const struct vector_policy *policy) {
+  const struct vector_policy *previous = __vector_policy;
+  __vector_policy = policy;
+  return previous;
+}
+
+__vector_inline__ vector_t vector_policy_keep(vector_t vector, _Bool keep) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+
+  // the empty vector is read-only, and it has no volume to keep until it's
+  // replaced by an allocation of its own
+  if (header == &__vector_empty) {
+    if (!keep)
+      return vector;
+    header = __vector_header_allocate(
+        NULL, _Alignof(max_align_t), sizeof(*header));
+    if (header == NULL)
+      return NULL;
+    header->volume = 0;
+    header->length = 0;
+  }
+
+  if (keep)
+    header->flags |= __VECTOR_KEEP;
+  else
+    header->flags &= (unsigned short) ~__VECTOR_KEEP;
+  return header->data;
+}
+
+__vector_inline__ size_t __vector_policy_scale(
+    size_t length,
+    size_t numerator,
+    size_t denominator,
+    size_t round,
+    size_t z) {
+  size_t volume, remainder;
+
+  // just volume = (length * numerator + denominator - 1) / denominator
+  // avoiding intermediate overflow
+  if (__builtin_mul_overflow(length / denominator, numerator, &volume))
+    return SIZE_MAX;
+  if (__builtin_mul_overflow(length % denominator, numerator, &remainder))
+    return SIZE_MAX;
+  remainder = remainder / denominator + (remainder % denominator != 0);
+  if (__builtin_add_overflow(volume, remainder, &volume))
+    return SIZE_MAX;
+
+  return __vector_policy_round(volume, round, z);
+}
+
+__vector_inline__
+size_t __vector_policy_round(size_t volume, size_t round, size_t z) {
+  size_t size;
+
+  if (round <= 1 || z == 0)
+    return volume;
+
+  // round the size of the vector (with its header) up to a multiple of round
+  // then fill that size with elements
+  if (__builtin_mul_overflow(volume, z, &size))
+    return SIZE_MAX;
+  if (__builtin_add_overflow(size, sizeof(struct __vector_header_t), &size))
+    return SIZE_MAX;
+  if (__builtin_add_overflow(size, (round - size % round) % round, &size))
+    return SIZE_MAX;
+
+  return (size - sizeof(struct __vector_header_t)) / z;
+}
+
+__vector_inline__ size_t __vector_policy_grow(size_t length, size_t z) {
+  const struct vector_policy *policy = __vector_policy;
+  size_t volume;
+
+  if (policy == NULL) {
+    // just volume = (length * 8 + 3) / 5 avoiding intermediate overflow
+    volume = length / 5 * 8 + ((length % 5) * 8 + 3) / 5;
+    return volume > length ? volume : length;
+  }
+
+  volume = __vector_policy_scale(length,
+      policy->growth_numerator, policy->growth_denominator, 0, z);
+  if (volume == SIZE_MAX)
+    return length;
+
+  // grow by at least step bytes
+  if (z != 0) {
+    size_t minimum = policy->step / z + (policy->step % z != 0);
+    if (__builtin_add_overflow(length, minimum, &minimum))
+      return length;
+    if (volume < minimum)
+      volume = minimum;
+  }
+
+  if ((volume = __vector_policy_round(volume, policy->round, z)) == SIZE_MAX)
+    return length;
+
+  // the size of the vector overflows whether or not it's rounded
+  if (z != 0 && volume > (SIZE_MAX - sizeof(struct __vector_header_t)) / z)
+    return length;
+  return volume > length ? volume : length;
+}
+
+__vector_inline__
+size_t __vector_policy_shrink(size_t length, size_t volume, size_t z) {
+  const struct vector_policy *policy = __vector_policy;
+  size_t shrunk;
+
+  if (policy == NULL) {
+    if (length > (volume - 1) / 2)
+      return volume;
+    // just volume = (length * 6 + 4) / 5 avoiding intermediate overflow
+    return length / 5 * 6 + ((length % 5) * 6 + 4) / 5;
+  }
+
+  if (policy->shrink_divisor == 0)
+    return volume;
+  if (length > (volume - 1) / policy->shrink_divisor)
+    return volume;
+
+  shrunk = __vector_policy_scale(length, policy->shrink_numerator,
+      policy->shrink_denominator, policy->round, z);
+
+  if (shrunk < length)
+    return length;
+  return shrunk < volume ? shrunk : volume;
+}
+
+#endif /* VECTOR_POLICY_C */
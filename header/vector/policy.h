@@ -0,0 +1,208 @@
+/**
+ * @file header/vector/policy.h
+ *
+ * A growth policy determines the volume that vector_ensure() preallocates as a
+ * vector grows and the volume that vector_excise() reduces a vector to as it
+ * shrinks. Each thread has its own policy, which is initially the default:
+ *
+ *   @f[ volume = \frac{length \times 8 + 3}{5} @f]
+ *
+ * on growth and, once the length of a vector is less than half of its volume:
+ *
+ *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ *
+ * on shrinkage. A different policy suits a different workload, such as a
+ * factor of 2 for a vector that's built by many appends, a factor of 5/4 for a
+ * vector that must be compact, or growth in whole pages for a vector of many
+ * megabytes:
+ *
+ * @code{.c}
+ *   static const struct vector_policy pages = {
+ *     .growth_numerator = 5, .growth_denominator = 4,
+ *     .round = 4096,
+ *     .shrink_divisor = 4, .shrink_numerator = 2, .shrink_denominator = 1,
+ *   };
+ *
+ *   const struct vector_policy *previous = vector_policy_set(&pages);
+ *   vector = vector_ensure(vector, 1 << 20);
+ *   vector_policy_set(previous);
+ * @endcode
+ *
+ * The policy is read each time a vector grows or shrinks, so it applies to
+ * each vector that the thread operates on while it's set rather than being
+ * recorded in the vector. Just the exemption of a vector from shrinkage by
+ * vector_policy_keep() is recorded in the vector, for one that's refilled to
+ * the same length after each time it's emptied.
+ */
+
+#ifndef VECTOR_POLICY_H
+#define VECTOR_POLICY_H
+
+#include <stddef.h>
+#include "common.h"
+
+/**
+ * @brief A growth policy for the volume of a vector
+ *
+ * On growth to a @a length the volume is the @a length multiplied by the
+ * growth factor, <tt>growth_numerator / growth_denominator</tt>, rounded up.
+ * The volume is then increased such that it grows by at least @a step bytes
+ * and such that the size of the vector (with its header) is a multiple of
+ * @a round bytes.
+ *
+ * On a removal from a vector that leaves its @a length less than its volume
+ * divided by @a shrink_divisor, its volume is reduced to the @a length
+ * multiplied by the shrink factor, <tt>shrink_numerator /
+ * shrink_denominator</tt>, rounded up and then rounded to @a round bytes as on
+ * growth. A @a shrink_divisor of zero disables this reduction. The gap between
+ * the divisor and the shrink factor is the hysteresis that prevents a vector
+ * that's alternately appended to and removed from being reallocated each time.
+ */
+struct vector_policy {
+  /// The numerator of the factor that the volume grows by
+  size_t growth_numerator;
+  /// The denominator of the factor that the volume grows by
+  size_t growth_denominator;
+  /// The minimum number of bytes that the volume grows by or zero
+  size_t step;
+  /// The number of bytes that the size of a vector is a multiple of or zero
+  size_t round;
+  /// The divisor of the volume that the length must be below to shrink or zero
+  size_t shrink_divisor;
+  /// The numerator of the factor of the length that the volume shrinks to
+  size_t shrink_numerator;
+  /// The denominator of the factor of the length that the volume shrinks to
+  size_t shrink_denominator;
+};
+
+/**
+ * @brief Return the growth policy of the calling thread
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_policy() == NULL;
+ *
+ *   vector_policy_set(&policy);
+ *   vector_policy() == &policy;
+ * @endcode
+ *
+ * If the calling thread uses the default policy then this is @c NULL.
+ */
+__vector_inline__ const struct vector_policy *vector_policy(void)
+  __attribute__((pure));
+
+/**
+ * @brief Set the growth policy of the calling thread to @a policy and return
+ *   its previous policy
+ *
+ * @par Example
+ * @code{.c}
+ *   static const struct vector_policy doubling = {
+ *     .growth_numerator = 2, .growth_denominator = 1,
+ *     .shrink_divisor = 4, .shrink_numerator = 2, .shrink_denominator = 1,
+ *   };
+ *
+ *   const struct vector_policy *previous = vector_policy_set(&doubling);
+ * @endcode
+ *
+ * If @a policy is @c NULL then the calling thread uses the default policy. The
+ * @a policy isn't copied, so it must remain valid while it's set. The behavior
+ * is undefined if @a growth_denominator is zero, or if @a shrink_divisor is
+ * nonzero and @a shrink_denominator is zero.
+ *
+ * @param policy the growth policy to set or @c NULL
+ * @return the previous growth policy of the calling thread
+ */
+__vector_inline__
+const struct vector_policy *vector_policy_set(
+    const struct vector_policy *policy);
+
+/**
+ * @brief Set whether a removal of elements from the @a vector keeps its
+ *   volume rather than reducing it by the growth policy
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(char) line = vector_policy_keep(vector_create(), 1);
+ *
+ *   while (line != NULL && read_line(&line) == 0)
+ *     line = vector_truncate(line, 0);
+ * @endcode
+ *
+ * While this is set the volume of the @a vector is reduced by just a resize,
+ * such as vector_shrink(), so a vector that's emptied and refilled isn't
+ * reallocated each time. The setting is retained as the @a vector is
+ * reallocated or unshared, but a copy of it by vector_duplicate() is unset.
+ * If the @a vector is shared by vector_share() then this applies to each of
+ * its references.
+ *
+ * The empty vector that vector_create() returns is read-only, so to set this
+ * on it the @a vector is replaced by an allocation from malloc() with zero
+ * @volume, and that's returned. On failure of that this returns @c NULL with
+ * the @a vector unmodified and the value of @c errno set by malloc() retained.
+ * Otherwise this returns the @a vector itself.
+ *
+ * @param vector the vector to operate on
+ * @param keep whether a removal keeps the volume of the @a vector
+ * @return the vector on success; otherwise @c NULL
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_policy_keep(vector_t vector, _Bool keep);
+
+/// @cond INTERNAL
+
+/// The growth policy of the calling thread or @c NULL for the default policy
+extern _Thread_local const struct vector_policy *__vector_policy;
+
+/**
+ * @brief Return @a length multiplied by <tt>numerator / denominator</tt>,
+ *   rounded up, then rounded with __vector_policy_round()
+ *
+ * If the calculation overflows then this is @c SIZE_MAX.
+ */
+__vector_inline__ size_t __vector_policy_scale(
+    size_t length,
+    size_t numerator,
+    size_t denominator,
+    size_t round,
+    size_t z)
+  __attribute__((const));
+
+/**
+ * @brief Return the greatest volume of elements of size @a z such that the
+ *   size of the vector (with its header) is a multiple of @a round bytes no
+ *   less than that with @a volume elements
+ *
+ * If @a round is zero or one then this is @a volume. If the calculation
+ * overflows then this is @c SIZE_MAX.
+ */
+__vector_inline__ size_t __vector_policy_round(
+    size_t volume, size_t round, size_t z)
+  __attribute__((const));
+
+/**
+ * @brief Return the volume to preallocate for a vector of @a length elements
+ *   of size @a z under the policy of the calling thread
+ *
+ * If the calculation overflows then this is @a length.
+ */
+__vector_inline__ size_t __vector_policy_grow(size_t length, size_t z)
+  __attribute__((pure));
+
+/**
+ * @brief Return the volume to reduce a vector of @a length elements of size
+ *   @a z and @a volume to under the policy of the calling thread
+ *
+ * If the vector shouldn't be reduced then this is @a volume.
+ */
+__vector_inline__
+size_t __vector_policy_shrink(size_t length, size_t volume, size_t z)
+  __attribute__((pure));
+
+/// @endcond
+
+#endif /* VECTOR_POLICY_H */
+
+#if (-1- __vector_inline__ -1)
+#include "policy.c"
+#endif /* __vector_inline__ */
@@ -3,6 +3,7 @@
 #ifndef VECTOR_REMOVE_C
 #define VECTOR_REMOVE_C
 
+#include <limits.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -10,6 +11,8 @@
 #include "remove.h"
 #include "access.h"
 #include "resize.h"
+#include "policy.h"
+#include "share.h"
 
 __vector_inline__
 vector_t vector_remove_z(vector_t vector, size_t i, size_t z) {
@@ -20,31 +23,147 @@ __vector_inline__
 vector_t vector_excise_z(vector_t vector, size_t i, size_t n, size_t z) {
   size_t length = vector_length(vector) - n;
 
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return NULL;
+
   // move the existing elements n elements toward the head
   void *target = vector_at(vector, i + 0, z);
   void *source = vector_at(vector, i + n, z);
   size_t size = (length - i) * z;
   memmove(target, source, size);
 
-  if (length <= (vector_volume(vector) - 1) / 2) {
-    vector_t resize;
-    // just volume = (length * 6 + 4) / 5 avoiding intermediate overflow
-    size_t volume = length / 5 * 6 + ((length % 5) * 6 + 4) / 5;
+  return __vector_reduce_z(vector, length, z);
+}
+
+__vector_inline__
+vector_t vector_truncate_z(vector_t vector, size_t length, size_t z) {
+  size_t n = vector_length(vector) - length;
+  return vector_excise_z(vector, vector_length(vector) - n, n, z);
+}
+
+__vector_inline__
+vector_t vector_truncate_keep_z(vector_t vector, size_t length, size_t z) {
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return NULL;
+
+  __vector_set_length(vector, length);
+  return vector;
+}
+
+__vector_inline__ vector_t vector_clear_z(vector_t vector, size_t z) {
+  return vector_truncate_keep_z(vector, 0, z);
+}
+
+__vector_inline__ vector_t vector_remove_if_z(
+    vector_t vector,
+    _Bool (*pred)(const void *elmt, void *data),
+    void *data,
+    size_t z) {
+  size_t length = vector_length(vector);
+  size_t kept = 0;
+
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return NULL;
+
+  // move each element that's kept toward the head over those that aren't
+  char *elmts = vector;
+  for (size_t i = 0; i < length; i++) {
+    if (pred(elmts + i * z, data))
+      continue;
+    if (kept != i)
+      memcpy(elmts + kept * z, elmts + i * z, z);
+    kept++;
+  }
+
+  return __vector_reduce_z(vector, kept, z);
+}
+
+__vector_inline__ vector_t vector_remove_indices_z(
+    vector_t vector, const size_t *indices, size_t k, size_t z) {
+  size_t length = vector_length(vector);
+
+  if (k == 0)
+    return vector;
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return NULL;
+
+  // move each run of elements between the indices toward the head over the
+  // elements that are removed before it
+  char *elmts = vector;
+  size_t kept = indices[0];
+  for (size_t j = 0; j < k; j++) {
+    size_t start = indices[j] + 1;
+    size_t end = j + 1 < k ? indices[j + 1] : length;
+    memmove(elmts + kept * z, elmts + start * z, (end - start) * z);
+    kept += end - start;
+  }
 
+  return __vector_reduce_z(vector, kept, z);
+}
+
+__vector_inline__ vector_t vector_remove_bitmap_z(
+    vector_t vector, const unsigned char *bitmap, size_t z) {
+  size_t length = vector_length(vector);
+  size_t kept = 0;
+
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return NULL;
+
+  // move each element that's kept toward the head over those that aren't
+  char *elmts = vector;
+  for (size_t i = 0; i < length; i++) {
+    if (bitmap[i / CHAR_BIT] >> i % CHAR_BIT & 1)
+      continue;
+    if (kept != i)
+      memcpy(elmts + kept * z, elmts + i * z, z);
+    kept++;
+  }
+
+  return __vector_reduce_z(vector, kept, z);
+}
+
+__vector_inline__
+vector_t vector_remove_unordered_z(vector_t vector, size_t i, size_t z) {
+  return vector_excise_unordered_z(vector, i, 1, z);
+}
+
+__vector_inline__ vector_t vector_excise_unordered_z(
+    vector_t vector, size_t i, size_t n, size_t z) {
+  size_t length = vector_length(vector) - n;
+
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return NULL;
+
+  // fill the removed elements from the tail, with at most as many elements as
+  // there are after them
+  size_t tail = length - i;
+  size_t fill = tail < n ? tail : n;
+  void *target = vector_at(vector, i, z);
+  void *source = vector_at(vector, length + n - fill, z);
+  memcpy(target, source, fill * z);
+
+  return __vector_reduce_z(vector, length, z);
+}
+
+__vector_inline__
+vector_t __vector_reduce_z(vector_t vector, size_t length, size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+
+  // a vector that keeps its volume, or that's in storage that it doesn't own,
+  // isn't shrunk by the policy
+  size_t volume = header->volume;
+  if (!(header->flags & (__VECTOR_LOCAL | __VECTOR_KEEP)))
+    volume = __vector_policy_shrink(length, volume, z);
+  if (volume != header->volume) {
+    vector_t resize;
     if ((resize = vector_resize_z(vector, volume, z)) != NULL)
       vector = resize;
   }
 
   // decrease the length
-  __vector_to_header(vector)->length = length;
+  __vector_set_length(vector, length);
 
   return vector;
 }
 
-__vector_inline__
-vector_t vector_truncate_z(vector_t vector, size_t length, size_t z) {
-  size_t n = vector_length(vector) - length;
-  return vector_excise_z(vector, vector_length(vector) - n, n, z);
-}
-
 #endif /* VECTOR_REMOVE_C */
@@ -17,14 +17,16 @@
  * \frac{1}{2}(volume - 1) @f$, a vector_resize() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * under the default growth policy (see vector_policy_set()).
  * On success the shrunk vector will be returned. Otherwise the vector will be
- * returned as is (without the element).
+ * returned as is (without the element). The @volume is never reduced if the
+ * @a vector keeps it by vector_policy_keep().
  *
  * If @a i isn't an index in the @a vector then the behavior is undefined.
  *
  * @param vector the vector to operate on
  * @param i the index in the @a vector of the element to remove
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 //= vector_t vector_remove(vector_t vector, size_t i)
 #define vector_remove(v, ...) vector_remove_z((v), __VA_ARGS__, VECTOR_Z((v)))
@@ -40,18 +42,20 @@
  * \frac{1}{2}(volume - 1) @f$, a vector_resize_z() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * under the default growth policy (see vector_policy_set()).
  * On success the shrunk vector will be returned. Otherwise the vector will be
- * returned as is (without the element).
+ * returned as is (without the element). The @volume is never reduced if the
+ * @a vector keeps it by vector_policy_keep().
  *
  * If @a i isn't an index in the @a vector then the behavior is undefined.
  *
  * @param vector the vector to operate on
  * @param i the index in the @a vector of the element to remove
  * @param z the element size of the @a vector
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 __vector_inline__ vector_t vector_remove_z(vector_t vector, size_t i, size_t z)
-  __attribute__((nonnull, returns_nonnull, warn_unused_result));
+  __attribute__((nonnull, warn_unused_result));
 
 /**
  * @brief Remove @a n elements at index @a i from the @a vector
@@ -64,8 +68,10 @@ __vector_inline__ vector_t vector_remove_z(vector_t vector, size_t i, size_t z)
  * \frac{1}{2}(volume - 1) @f$, a vector_resize() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * under the default growth policy (see vector_policy_set()).
  * On success the shrunk vector will be returned. Otherwise the vector will be
- * returned as is (without the elements).
+ * returned as is (without the elements). The @volume is never reduced if the
+ * @a vector keeps it by vector_policy_keep().
  *
  * If @a i or any index from @a i to <code>i + n</code> inclusive isn't an index
  * in the @a vector then the behavior is undefined.
@@ -73,7 +79,7 @@ __vector_inline__ vector_t vector_remove_z(vector_t vector, size_t i, size_t z)
  * @param vector the vector to operate on
  * @param i the index in the @a vector of the elements to remove
  * @param n the number of elements to remove from the @a vector
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 //= vector_t vector_excise(vector_t vector, size_t i, size_t n)
 #define vector_excise(v, ...) vector_excise_z((v), __VA_ARGS__, VECTOR_Z((v)))
@@ -89,8 +95,14 @@ __vector_inline__ vector_t vector_remove_z(vector_t vector, size_t i, size_t z)
  * \frac{1}{2}(volume - 1) @f$, a vector_resize_z() will be attempted to reduce
  * the @volume to:
  *   @f[ volume = \frac{length \times 6 + 4}{5} @f]
+ * under the default growth policy (see vector_policy_set()).
  * On success the shrunk vector will be returned. Otherwise the vector will be
- * returned as is (without the elements).
+ * returned as is (without the elements). The @volume is never reduced if the
+ * @a vector keeps it by vector_policy_keep().
+ *
+ * If the @a vector is shared by vector_share() then it's first unshared by
+ * vector_unshare_z(). If that fails then this returns @c NULL with the
+ * @a vector unmodified.
  *
  * If @a i or any index from @a i to <code>i + n</code> inclusive isn't an index
  * in the @a vector then the behavior is undefined.
@@ -99,9 +111,9 @@ __vector_inline__ vector_t vector_remove_z(vector_t vector, size_t i, size_t z)
  * @param i the index in the @a vector of the elements to remove
  * @param n the number of elements to remove from the @a vector
  * @param z the element size of the @a vector
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
-__attribute__((nonnull, returns_nonnull, warn_unused_result))
+__attribute__((nonnull, warn_unused_result))
 __vector_inline__
 vector_t vector_excise_z(vector_t vector, size_t i, size_t n, size_t z);
 
@@ -118,7 +130,7 @@ vector_t vector_excise_z(vector_t vector, size_t i, size_t n, size_t z);
  *
  * @param vector the vector to operate on
  * @param length the length of the resultant vector
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 //= vector_t vector_truncate(vector_t vector, size_t length)
 #define vector_truncate(v, ...) \
@@ -138,12 +150,398 @@ vector_t vector_excise_z(vector_t vector, size_t i, size_t n, size_t z);
  * @param vector the vector to operate on
  * @param length the length of the resultant vector
  * @param z the element size of the @a vector
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
-__attribute__((nonnull, returns_nonnull, warn_unused_result))
+__attribute__((nonnull, warn_unused_result))
 __vector_inline__
 vector_t vector_truncate_z(vector_t vector, size_t length, size_t z);
 
+/**
+ * @brief Reduce the @length of the @a vector to @a length without reducing its
+ *   @volume
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8);
+ *
+ *   vector = vector_truncate_keep(vector, 2);
+ *   // vector ≡ [1, 2], vector_volume(vector) == 5
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param length the length of the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_truncate_keep_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_truncate_keep(vector_t vector, size_t length)
+#define vector_truncate_keep(v, ...) \
+  vector_truncate_keep_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Reduce the @length of the @a vector to @a length without reducing its
+ *   @volume
+ *
+ * @par Example
+ * @code{.c}
+ *   vector = vector_truncate_keep_z(vector, 2, sizeof(int));
+ * @endcode
+ *
+ * This is vector_truncate_z() except that the @a vector is never reallocated,
+ * so it keeps its volume for the elements that refill it, whether or not it
+ * keeps it by vector_policy_keep().
+ *
+ * If the @a vector is shared by vector_share() then it's first unshared by
+ * vector_unshare_z(). If that fails then this returns @c NULL with the
+ * @a vector unmodified.
+ *
+ * If @a length is greater than the @length of the @a vector then the behavior
+ * is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param length the length of the resultant vector
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_truncate_keep() - the implicit analogue to this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__
+vector_t vector_truncate_keep_z(vector_t vector, size_t length, size_t z);
+
+/**
+ * @brief Remove each element of the @a vector without reducing its @volume
+ *
+ * @par Example
+ * @code{.c}
+ *   for (size_t i = 0; i < n; i++) {
+ *     scratch = vector_clear(scratch);
+ *     fill(&scratch, i);
+ *   }
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_clear_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_clear(vector_t vector)
+#define vector_clear(v) vector_clear_z((v), VECTOR_Z((v)))
+
+/**
+ * @brief Remove each element of the @a vector without reducing its @volume
+ *
+ * @par Example
+ * @code{.c}
+ *   scratch = vector_clear_z(scratch, sizeof(int));
+ *   // vector_length(scratch) == 0
+ * @endcode
+ *
+ * This is vector_truncate_keep_z() to a length of zero.
+ *
+ * @param vector the vector to operate on
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_clear() - the implicit analogue to this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_clear_z(vector_t vector, size_t z);
+
+/**
+ * @brief Remove each element of the @a vector that @a pred is true of
+ *
+ * @par Example
+ * @code{.c}
+ *   static _Bool odd(const void *elmt, void *data) {
+ *     return *(const int *) elmt % 2 != 0;
+ *   }
+ *
+ *   vector = vector_remove_if(vector, odd, NULL);
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param pred the predicate of the elements to remove
+ * @param data the data to pass to @a pred with each element
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_if_z() - the explicit analogue of this operation
+ */
+//= vector_t vector_remove_if(vector_t vector,
+//=   _Bool (*pred)(const void *elmt, void *data), void *data)
+#define vector_remove_if(v, ...) \
+  vector_remove_if_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove each element of the @a vector that @a pred is true of
+ *
+ * @par Example
+ * @code{.c}
+ *   static _Bool odd(const void *elmt, void *data) {
+ *     return *(const int *) elmt % 2 != 0;
+ *   }
+ *
+ *   vector = vector_remove_if_z(vector, odd, NULL, sizeof(int));
+ * @endcode
+ *
+ * The predicate @a pred is called with a pointer to each element of the
+ * @a vector, from its head to its tail, and @a data. The elements that it's
+ * false of are kept in their order, and each is moved at most once, toward the
+ * head of the @a vector, so this takes a linear time however many elements are
+ * removed. The @volume of the @a vector follows the rule in vector_excise_z()
+ * just once, for the resultant @length.
+ *
+ * If the @a vector is shared by vector_share() then it's first unshared by
+ * vector_unshare_z(). If that fails then this returns @c NULL with the
+ * @a vector unmodified.
+ *
+ * If @a pred modifies the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param pred the predicate of the elements to remove
+ * @param data the data to pass to @a pred with each element
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_if() - the implicit analogue of this operation
+ */
+__attribute__((nonnull(1, 2), warn_unused_result))
+__vector_inline__ vector_t vector_remove_if_z(
+    vector_t vector,
+    _Bool (*pred)(const void *elmt, void *data),
+    void *data,
+    size_t z);
+
+/**
+ * @brief Remove the @a k elements at the @a indices from the @a vector
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8);
+ *   vector = vector_remove_indices(vector, (size_t[]) { 0, 2, 3 }, 3);
+ *   // vector ≡ [2, 8]
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param indices the indices in the @a vector of the elements to remove
+ * @param k the number of @a indices
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_indices_z() - the explicit analogue of this operation
+ */
+//= vector_t vector_remove_indices(
+//=   vector_t vector, const size_t *indices, size_t k)
+#define vector_remove_indices(v, ...) \
+  vector_remove_indices_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove the @a k elements at the @a indices from the @a vector
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8);
+ *   vector = vector_remove_indices_z(vector, (size_t[]) { 0, 2, 3 }, 3,
+ *       sizeof(int));
+ *   // vector ≡ [2, 8]
+ * @endcode
+ *
+ * The elements that remain are kept in their order. This is more efficient
+ * than @a k separate calls to vector_remove_z(), which each move each element
+ * after the index and may each reallocate the @a vector. Instead each run of
+ * elements between two of the @a indices is moved once, toward the head of the
+ * @a vector, and the @volume of the @a vector follows the rule in
+ * vector_excise_z() just once, for the resultant @length.
+ *
+ * If the @a vector is shared by vector_share() then it's first unshared by
+ * vector_unshare_z(). If that fails then this returns @c NULL with the
+ * @a vector unmodified.
+ *
+ * If the @a indices aren't in strictly ascending order, or any of them isn't an
+ * index in the @a vector, then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param indices the indices in the @a vector of the elements to remove
+ * @param k the number of @a indices
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_indices() - the implicit analogue of this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_remove_indices_z(
+    vector_t vector, const size_t *indices, size_t k, size_t z);
+
+/**
+ * @brief Remove each element of the @a vector that's marked in the @a bitmap
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8);
+ *   vector = vector_remove_bitmap(vector, (unsigned char[]) { 0x0d });
+ *   // vector ≡ [2, 8]
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param bitmap the bits of the elements to remove
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_bitmap_z() - the explicit analogue of this operation
+ */
+//= vector_t vector_remove_bitmap(vector_t vector, const unsigned char *bitmap)
+#define vector_remove_bitmap(v, ...) \
+  vector_remove_bitmap_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove each element of the @a vector that's marked in the @a bitmap
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8);
+ *   vector = vector_remove_bitmap_z(vector, (unsigned char[]) { 0x0d },
+ *       sizeof(int));
+ *   // vector ≡ [2, 8]
+ * @endcode
+ *
+ * The element at index @a i is removed if the bit <tt>i % CHAR_BIT</tt>, from
+ * the least significant bit, of the byte <tt>bitmap[i / CHAR_BIT]</tt> is set.
+ * This is vector_remove_if_z() except that the elements to remove are marked
+ * by the @a bitmap rather than a predicate.
+ *
+ * If the @a bitmap has fewer bits than the @length of the @a vector then the
+ * behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param bitmap the bits of the elements to remove
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_bitmap() - the implicit analogue of this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_remove_bitmap_z(
+    vector_t vector, const unsigned char *bitmap, size_t z);
+
+/**
+ * @brief Remove the element at index @a i from the @a vector, moving the last
+ *   element in its place
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8);
+ *   vector = vector_remove_unordered(vector, 1);
+ *   // vector ≡ [1, 8, 3, 5]
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector of the element to remove
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_unordered_z() - the explicit analogue of this operation
+ */
+//= vector_t vector_remove_unordered(vector_t vector, size_t i)
+#define vector_remove_unordered(v, ...) \
+  vector_remove_unordered_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove the element at index @a i from the @a vector, moving the last
+ *   element in its place
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8);
+ *   vector = vector_remove_unordered_z(vector, 1, sizeof(int));
+ *   // vector ≡ [1, 8, 3, 5]
+ * @endcode
+ *
+ * This is vector_excise_unordered_z() of a single element.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector of the element to remove
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_remove_unordered() - the implicit analogue of this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__
+vector_t vector_remove_unordered_z(vector_t vector, size_t i, size_t z);
+
+/**
+ * @brief Remove @a n elements at index @a i from the @a vector, moving the
+ *   last elements in their place
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8, 13);
+ *   vector = vector_excise_unordered(vector, 1, 2);
+ *   // vector ≡ [1, 8, 13, 5]
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector of the elements to remove
+ * @param n the number of elements to remove from the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_excise_unordered_z() - the explicit analogue of this operation
+ */
+//= vector_t vector_excise_unordered(vector_t vector, size_t i, size_t n)
+#define vector_excise_unordered(v, ...) \
+  vector_excise_unordered_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Remove @a n elements at index @a i from the @a vector, moving the
+ *   last elements in their place
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3, 5, 8, 13);
+ *   vector = vector_excise_unordered_z(vector, 1, 2, sizeof(int));
+ *   // vector ≡ [1, 8, 13, 5]
+ * @endcode
+ *
+ * This is vector_excise_z() except that the order of the elements that remain
+ * isn't retained. Rather than each element after the removed elements being
+ * shifted toward the head of the @a vector, the removed elements are filled by
+ * at most @a n elements from the tail of the @a vector, so this takes a time in
+ * proportion to @a n rather than to the @length of the @a vector. The @volume
+ * of the @a vector follows the rule in vector_excise_z().
+ *
+ * If the @a vector is shared by vector_share() then it's first unshared by
+ * vector_unshare_z(). If that fails then this returns @c NULL with the
+ * @a vector unmodified.
+ *
+ * If @a i or any index from @a i to <code>i + n</code> inclusive isn't an index
+ * in the @a vector then the behavior is undefined.
+ *
+ * @param vector the vector to operate on
+ * @param i the index in the @a vector of the elements to remove
+ * @param n the number of elements to remove from the @a vector
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_excise_unordered() - the implicit analogue of this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_excise_unordered_z(
+    vector_t vector, size_t i, size_t n, size_t z);
+
+/// @cond INTERNAL
+
+/**
+ * @brief Reduce the @length of the @a vector, from which elements have been
+ *   removed, to @a length
+ *
+ * The @volume of the @a vector is first reduced by the shrink policy of the
+ * calling thread (see vector_policy_set()), as in vector_excise_z(), unless
+ * it keeps its volume by vector_policy_keep(). If that fails then the
+ * @a vector keeps its volume.
+ */
+__attribute__((nonnull, returns_nonnull, warn_unused_result))
+__vector_inline__
+vector_t __vector_reduce_z(vector_t vector, size_t length, size_t z);
+
+/// @endcond
+
 #endif /* VECTOR_REMOVE_H */
 
 #if (-1- __vector_inline__ -1)
@@ -4,23 +4,40 @@
 #define VECTOR_RESIZE_C
 
 #include <errno.h>
-#include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
 
 #include "common.h"
 #include "resize.h"
+#include "allocator.h"
+#include "policy.h"
+#include "share.h"
 
 __vector_inline__
 vector_t vector_resize_z(vector_t vector, size_t volume, size_t z) {
   struct __vector_header_t *header = __vector_to_header(vector);
   size_t size;
 
+  // a vector in storage that it doesn't own stays in it while it fits, with
+  // the volume of the storage kept for it to grow back into, which leaves the
+  // empty vector unmodified
+  if (header->flags & __VECTOR_LOCAL && volume <= header->volume) {
+    if (volume < header->length)
+      header->length = volume;
+    return vector;
+  }
+
   // calculate size and test for overflow
   if (__builtin_mul_overflow(volume, z, &size))
     return errno = ENOMEM, NULL;
   if (__builtin_add_overflow(size, sizeof(*header), &size))
     return errno = ENOMEM, NULL;
 
-  if ((header = realloc(header, size)) == NULL)
+  // just the header and the elements that remain need to be retained
+  size_t used = header->length < volume ? header->length : volume;
+  used = sizeof(*header) + used * z;
+  size_t skew = __vector_skew(vector);
+  if ((header = __vector_header_reallocate(header, skew, size, used)) == NULL)
     return NULL;
 
   if ((header->volume = volume) < header->length)
@@ -42,19 +59,66 @@ vector_t vector_ensure_z(vector_t vector, size_t length, size_t z) {
   if (length <= vector_volume(vector))
     return vector;
 
-  // just volume = (length * 8 + 3) / 5 avoiding intermediate overflow
-  size_t volume = length / 5 * 8 + ((length % 5) * 8 + 3) / 5;
+  size_t volume = __vector_policy_grow(length, z);
+  vector_t resize = NULL;
 
   // if the volume doesn't overflow then attempt to allocate it
-  if (volume > length) {
-    vector_t resize;
-    if ((resize = vector_resize_z(vector, volume, z)) != NULL)
-      return resize;
-  }
+  if (volume > length)
+    resize = vector_resize_z(vector, volume, z);
 
   // if either the volume overflows or the allocation failed then attempt to
   // resize to just the length
+  if (resize == NULL && (resize = vector_resize_z(vector, length, z)) == NULL)
+    return NULL;
+
+  // record any space that the allocator gave beyond that asked for as volume
+  struct __vector_header_t *header = __vector_to_header(resize);
+  if ((volume = __vector_header_usable(header, z) / z) > header->volume)
+    header->volume = volume;
+
+  return resize;
+}
+
+__vector_inline__
+vector_t vector_reserve_z(vector_t vector, size_t length, size_t z) {
+  if (length <= vector_volume(vector))
+    return vector;
   return vector_resize_z(vector, length, z);
 }
 
+__vector_inline__
+vector_t vector_resize_zeroed_z(vector_t vector, size_t volume, size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+  size_t size;
+
+  // a resize within the volume just zeroes the elements beyond the length, so
+  // a shared vector that isn't resized is unshared to be written
+  if (volume <= header->volume) {
+    if (volume != header->volume)
+      vector = vector_resize_z(vector, volume, z);
+    else
+      vector = vector_unshare_z(vector, z);
+    if (vector == NULL)
+      return NULL;
+    size_t length = vector_length(vector);
+    memset((char *) vector + length * z, 0, (volume - length) * z);
+    return vector;
+  }
+
+  // calculate size and test for overflow
+  if (__builtin_mul_overflow(volume, z, &size))
+    return errno = ENOMEM, NULL;
+  if (__builtin_add_overflow(size, sizeof(*header), &size))
+    return errno = ENOMEM, NULL;
+
+  size_t used = sizeof(*header) + header->length * z;
+  size_t skew = __vector_skew(vector);
+  header = __vector_header_reallocate_zeroed(header, skew, size, used);
+  if (header == NULL)
+    return NULL;
+
+  header->volume = volume;
+  return header->data;
+}
+
 #endif /* VECTOR_RESIZE_C */
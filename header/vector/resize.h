@@ -39,6 +39,14 @@
  * either case if the realloc() fails then the @a vector will be unmodified and
  * the value of @c errno set by realloc() will be retained.
  *
+ * If the @a vector is shared by vector_share() then it's instead moved to an
+ * allocation of its own, which unshares it, and on failure of that the
+ * @a vector is unmodified and remains shared.
+ *
+ * A @a vector in storage that it doesn't own (see vector_create_local()) isn't
+ * reallocated while @a volume fits in that storage. Its @volume remains that of
+ * the storage and just its @length is reduced to @a volume if it's greater.
+ *
  * @param vector the vector to operate on
  * @param volume the volume to resize the @a vector to
  * @param z the element size of the @a vector
@@ -57,9 +65,14 @@ vector_t vector_resize_z(vector_t vector, size_t volume, size_t z);
  * will be called. Preallocation is attempted to accomodate future increases in
  * @length according to the formula:
  *   @f[ volume = \frac{length \times 8 + 3}{5} @f]
+ * under the default growth policy (see vector_policy_set()).
  * If this preallocation fails then a resize to @a length will be attempted. If
  * that also fails then the @a vector will be unmodified.
  *
+ * Where the allocator of the @a vector reports a usable size of its allocation
+ * greater than that requested (see ::vector_allocator), the @volume of the
+ * resultant vector includes that space.
+ *
  * On success, subsequent insertions (through vector_insert(), vector_append(),
  * etc.) into the vector are guaranteed to be successful so long as the
  * resultant length doesn't exceed @a length. Note that the @a vector doesn't
@@ -81,9 +94,14 @@ vector_t vector_resize_z(vector_t vector, size_t volume, size_t z);
  * will be called. Preallocation is attempted to accomodate future increases in
  * @length according to the formula:
  *   @f[ volume = \frac{length \times 8 + 3}{5} @f]
+ * under the default growth policy (see vector_policy_set()).
  * If this preallocation fails then a resize to @a length will be attempted. If
  * that also fails then the @a vector will be unmodified.
  *
+ * Where the allocator of the @a vector reports a usable size of its allocation
+ * greater than that requested (see ::vector_allocator), the @volume of the
+ * resultant vector includes that space.
+ *
  * On success, subsequent insertions (through vector_insert_z(),
  * vector_append_z(), etc.) into the vector are guaranteed to be successful so
  * long as the resultant length doesn't exceed @a length. Note that the
@@ -100,6 +118,61 @@ __attribute__((nonnull, warn_unused_result))
 __vector_inline__
 vector_t vector_ensure_z(vector_t vector, size_t length, size_t z);
 
+/**
+ * @brief Ensure that the @volume of the @a vector is no less than @a length
+ *   without preallocation
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_create();
+ *   vector = vector_reserve(vector, 1000);
+ *   vector_volume(vector) == 1000;
+ * @endcode
+ *
+ * If the volume of the @a vector is less than @a length then vector_resize()
+ * will be called to resize it to exactly @a length. Unlike vector_ensure() no
+ * preallocation is attempted, so when the final length of a vector is known
+ * this never allocates more than is needed. If the resize fails then the
+ * @a vector will be unmodified.
+ *
+ * @param vector the vector to operate on
+ * @param length the minimum length to accomodate in the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_reserve_z() - the explicit interface analogue
+ */
+//= vector_t vector_reserve(vector_t vector, size_t length)
+#define vector_reserve(v, ...) \
+  vector_reserve_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Ensure that the @volume of the @a vector is no less than @a length
+ *   without preallocation
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_create();
+ *   vector = vector_reserve_z(vector, 1000, sizeof(int));
+ *   vector_volume(vector) == 1000;
+ * @endcode
+ *
+ * If the volume of the @a vector is less than @a length then vector_resize_z()
+ * will be called to resize it to exactly @a length. Unlike vector_ensure_z()
+ * no preallocation is attempted, so when the final length of a vector is known
+ * this never allocates more than is needed. If the resize fails then the
+ * @a vector will be unmodified.
+ *
+ * @param vector the vector to operate on
+ * @param length the minimum length to accomodate in the @a vector
+ * @param z the element size of the @a vector
+ * @return the resultant vector on success; otherwise @c NULL
+ *
+ * @see vector_reserve() - the implicit interface analogue
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__
+vector_t vector_reserve_z(vector_t vector, size_t length, size_t z);
+
 /**
  * @brief Reduce the @volume of the @a vector to its @length
  *
@@ -131,6 +204,64 @@ vector_t vector_ensure_z(vector_t vector, size_t length, size_t z);
 __vector_inline__ vector_t vector_shrink_z(vector_t vector, size_t z)
   __attribute__((nonnull, returns_nonnull, warn_unused_result));
 
+/**
+ * @brief Resize the @volume of the @a vector to @a volume with each element
+ *   from its @length to @a volume zeroed
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(size_t) count = vector_create();
+ *   count = vector_resize_zeroed(count, 1 << 20);
+ *   count = vector_extend(count, NULL, 1 << 20);
+ *   // vector_length(count) == 1 << 20 and count[i] == 0
+ * @endcode
+ *
+ * @param vector the vector to operate on
+ * @param volume the volume to resize the @a vector to
+ * @return the resized vector on success; otherwise @c NULL
+ *
+ * @see vector_resize_zeroed_z() - the explicit interface analogue
+ */
+//= vector_t vector_resize_zeroed(vector_t vector, size_t volume)
+#define vector_resize_zeroed(v, ...) \
+  vector_resize_zeroed_z((v), __VA_ARGS__, VECTOR_Z((v)))
+
+/**
+ * @brief Resize the @volume of the @a vector to @a volume with each element
+ *   from its @length to @a volume zeroed
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(size_t) count = vector_create();
+ *   count = vector_resize_zeroed_z(count, 1 << 20, sizeof(size_t));
+ *   count = vector_extend_z(count, NULL, 1 << 20, sizeof(size_t));
+ *   // vector_length(count) == 1 << 20 and count[i] == 0
+ * @endcode
+ *
+ * This is vector_resize_z() where each element from the @length of the
+ * resultant vector to @a volume is zero (each bit of it is zero), so that the
+ * @length can then be increased over them, such as by vector_extend_z() with
+ * @c NULL elements.
+ *
+ * A vector that's allocated by malloc() with the default alignment, and that's
+ * grown by more than it holds, is moved to a fresh allocation from calloc()
+ * rather than reallocated. Where calloc() takes the allocation straight from
+ * the system (such as a mapping of a large size on glibc) its memory is already
+ * zero, so the added elements aren't written at all. Otherwise they're zeroed
+ * with memset(). On failure the @a vector is unmodified and the value of
+ * @c errno set by calloc() or realloc() will be retained.
+ *
+ * @param vector the vector to operate on
+ * @param volume the volume to resize the @a vector to
+ * @param z the element size of the @a vector
+ * @return the resized vector on success; otherwise @c NULL
+ *
+ * @see vector_resize_zeroed() - the implicit interface analogue
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__
+vector_t vector_resize_zeroed_z(vector_t vector, size_t volume, size_t z);
+
 #endif /* VECTOR_RESIZE_H */
 
 #if (-1- __vector_inline__ -1)
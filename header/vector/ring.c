@@ -0,0 +1,151 @@
+/// @file header/vector/ring.c
+
+#ifndef VECTOR_RING_C
+#define VECTOR_RING_C
+
+#include <errno.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "common.h"
+#include "ring.h"
+#include "access.h"
+#include "resize.h"
+#include "share.h"
+
+__vector_inline__
+int vector_ring_begin_z(struct vector_ring *ring, vector_t vector, size_t z) {
+  if ((vector = vector_unshare_z(vector, z)) == NULL)
+    return -1;
+
+  ring->vector = vector;
+  ring->z = z;
+  ring->head = 0;
+  ring->length = vector_length(vector);
+  return 0;
+}
+
+__vector_inline__ size_t vector_ring_length(const struct vector_ring *ring) {
+  return ring->length;
+}
+
+__vector_inline__
+void *vector_ring_at(const struct vector_ring *ring, size_t i) {
+  size_t volume = vector_volume(ring->vector);
+
+  // the head is within the volume, so the index wraps around it at most once
+  if ((i += ring->head) >= volume)
+    i -= volume;
+  return vector_at(ring->vector, i, ring->z);
+}
+
+__vector_inline__ int vector_ring_push(
+    struct vector_ring *restrict ring, const void *restrict elmt) {
+  if (ring->length == vector_volume(ring->vector) && __vector_ring_grow(ring))
+    return -1;
+
+  void *target = vector_ring_at(ring, ring->length++);
+  if (elmt != NULL)
+    memcpy(target, elmt, ring->z);
+  return 0;
+}
+
+__vector_inline__ int vector_ring_unshift(
+    struct vector_ring *restrict ring, const void *restrict elmt) {
+  if (ring->length == vector_volume(ring->vector) && __vector_ring_grow(ring))
+    return -1;
+
+  if (ring->head-- == 0)
+    ring->head = vector_volume(ring->vector) - 1;
+  ring->length++;
+  if (elmt != NULL)
+    memcpy(vector_at(ring->vector, ring->head, ring->z), elmt, ring->z);
+  return 0;
+}
+
+__vector_inline__
+void vector_ring_pull(struct vector_ring *restrict ring, void *restrict elmt) {
+  void *source = vector_ring_at(ring, --ring->length);
+  if (elmt != NULL)
+    memcpy(elmt, source, ring->z);
+}
+
+__vector_inline__
+void vector_ring_shift(struct vector_ring *restrict ring, void *restrict elmt) {
+  if (elmt != NULL)
+    memcpy(elmt, vector_at(ring->vector, ring->head, ring->z), ring->z);
+  if (++ring->head == vector_volume(ring->vector))
+    ring->head = 0;
+  ring->length--;
+}
+
+__vector_inline__ vector_t vector_ring_linearize(struct vector_ring *ring) {
+  size_t z = ring->z;
+  size_t volume = vector_volume(ring->vector);
+  char *data = ring->vector;
+
+  // the elements are rotated by reversing those before and from the head and
+  // then the whole volume
+  if (ring->head > volume - ring->length) {
+    __vector_ring_reverse(data, ring->head, z);
+    __vector_ring_reverse(data + ring->head * z, volume - ring->head, z);
+    __vector_ring_reverse(data, volume, z);
+  } else if (ring->head != 0)
+    memmove(data, data + ring->head * z, ring->length * z);
+
+  __vector_set_length(ring->vector, ring->length);
+  ring->head = 0;
+  return ring->vector;
+}
+
+__vector_inline__ int __vector_ring_grow(struct vector_ring *ring) {
+  struct __vector_header_t *header = __vector_to_header(ring->vector);
+  size_t z = ring->z;
+  size_t volume = header->volume;
+  size_t length;
+  vector_t resize;
+
+  if (__builtin_add_overflow(volume, 1, &length))
+    return errno = ENOMEM, -1;
+
+  // each element of the volume is an element of the ring, which is retained
+  // by the resize
+  __vector_set_length(ring->vector, volume);
+  if ((resize = vector_ensure_z(ring->vector, length, z)) == NULL)
+    return -1;
+
+  header = __vector_to_header(resize);
+  size_t grown = header->volume;
+  size_t tail = volume - ring->head;
+  char *data = resize;
+
+  // the elements that wrap around the end of the old volume are unwrapped by
+  // moving either those before the head after them or those from the head to
+  // the end of the new volume, whichever are fewer
+  if (ring->head <= grown - volume && ring->head <= tail)
+    memcpy(data + volume * z, data, ring->head * z);
+  else {
+    memmove(data + (grown - tail) * z, data + ring->head * z, tail * z);
+    ring->head = grown - tail;
+  }
+
+  ring->vector = resize;
+  return 0;
+}
+
+__vector_inline__ void __vector_ring_reverse(void *data, size_t n, size_t z) {
+  unsigned char *low = data;
+  unsigned char *high = low + n * z;
+
+  for (; n >= 2; n -= 2) {
+    high -= z;
+    for (size_t k = 0; k < z; k++) {
+      unsigned char byte = low[k];
+      low[k] = high[k];
+      high[k] = byte;
+    }
+    low += z;
+  }
+}
+
+#endif /* VECTOR_RING_C */
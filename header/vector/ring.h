@@ -0,0 +1,253 @@
+/**
+ * @file header/vector/ring.h
+ *
+ * A ring buffer uses the volume of a vector as a circle that its elements run
+ * around from a head index, so that elements are pushed and pulled at its tail
+ * and unshifted and shifted at its head in a constant time each, without any
+ * element being moved:
+ *
+ * @code{.c}
+ *   struct vector_ring ring;
+ *
+ *   vector_ring_begin(&ring, queue);
+ *   vector_ring_push(&ring, &job);
+ *   while (vector_ring_length(&ring) != 0)
+ *     vector_ring_shift(&ring, &job);
+ *   queue = vector_ring_linearize(&ring);
+ * @endcode
+ *
+ * While the ring is in use the elements of the vector wrap around the end of
+ * its volume, so they're accessed by vector_ring_at() rather than by their
+ * index in the vector, and the vector mustn't be operated on other than
+ * through the ring. vector_ring_linearize() rotates the elements to the start
+ * of the vector and returns it. The ring can then be used for more operations.
+ *
+ * The ring is grown by vector_ensure_z() once it fills the volume of the
+ * vector, so by the growth policy of the calling thread (see
+ * vector_policy_set()). The volume is never reduced while the ring is in use.
+ */
+
+#ifndef VECTOR_RING_H
+#define VECTOR_RING_H
+
+#include <stddef.h>
+#include "common.h"
+
+/// A ring buffer over a vector
+struct vector_ring {
+  /// The vector, with the elements of the ring wrapped around its volume
+  vector_t vector;
+  /// The element size of the vector
+  size_t z;
+  /// The index in the vector of the first element of the ring
+  size_t head;
+  /// The number of elements in the ring
+  size_t length;
+};
+
+/**
+ * @brief Begin to operate on the @a vector as the @a ring
+ *
+ * @par Example
+ * @code{.c}
+ *   struct vector_ring ring;
+ *   vector_ring_begin(&ring, vector);
+ * @endcode
+ *
+ * @param ring the ring buffer to begin
+ * @param vector the vector to operate on
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_ring_begin_z() - the explicit analogue to this operation
+ */
+//= int vector_ring_begin(struct vector_ring *ring, vector_t vector)
+#define vector_ring_begin(ring, v) \
+  vector_ring_begin_z((ring), (v), VECTOR_Z((v)))
+
+/**
+ * @brief Begin to operate on the @a vector of element size @a z as the
+ *   @a ring
+ *
+ * @par Example
+ * @code{.c}
+ *   struct vector_ring ring;
+ *   vector_ring_begin_z(&ring, vector, sizeof(int));
+ * @endcode
+ *
+ * The elements of the @a vector are the elements of the @a ring from its head.
+ * The @a vector is then held by the @a ring and is invalidated, as it may be
+ * replaced by a push or an unshift, until it's returned by
+ * vector_ring_linearize().
+ *
+ * A @a vector that's shared by vector_share() is first unshared by
+ * vector_unshare_z(). If that fails then this returns -1 with the @a vector
+ * unmodified and the value of @c errno set by it retained.
+ *
+ * @param ring the ring buffer to begin
+ * @param vector the vector to operate on
+ * @param z the element size of the @a vector
+ * @return zero on success; otherwise -1
+ *
+ * @see vector_ring_begin() - the implicit analogue to this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__
+int vector_ring_begin_z(struct vector_ring *ring, vector_t vector, size_t z);
+
+/**
+ * @brief Return the number of elements in the @a ring
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_ring_begin(&ring, vector_define(int, 1, 2, 3));
+ *   // vector_ring_length(&ring) == 3
+ * @endcode
+ */
+__attribute__((nonnull, pure))
+__vector_inline__ size_t vector_ring_length(const struct vector_ring *ring);
+
+/**
+ * @brief Return a pointer to the element at index @a i in the @a ring
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_ring_unshift(&ring, &(int) { 4 });
+ *   // *(int *) vector_ring_at(&ring, 0) == 4
+ * @endcode
+ *
+ * The index @a i is counted from the head of the @a ring, which is the index
+ * of the element once the ring is linearized. If @a i isn't an index in the
+ * @a ring then the behavior is undefined.
+ */
+__attribute__((nonnull, pure))
+__vector_inline__
+void *vector_ring_at(const struct vector_ring *ring, size_t i);
+
+/**
+ * @brief Insert the object at @a elmt as the last element in the @a ring
+ *
+ * @par Example
+ * @code{.c}
+ *   if (vector_ring_push(&ring, &job) == -1)
+ *     perror("vector_ring_push");
+ * @endcode
+ *
+ * If @a elmt is @c NULL then the inserted element will be uninitialized.
+ *
+ * If the @a ring fills the volume of its vector then the vector is first grown
+ * by vector_ensure_z(). If that fails then this returns -1 with the @a ring
+ * unmodified and the value of @c errno set by it retained.
+ *
+ * If @a elmt is a location in the vector of the @a ring then the behavior is
+ * undefined.
+ *
+ * @param ring the ring buffer to push onto
+ * @param elmt a pointer to the element to push, or @c NULL
+ * @return zero on success; otherwise -1
+ */
+__attribute__((nonnull(1), warn_unused_result))
+__vector_inline__ int vector_ring_push(
+    struct vector_ring *restrict ring, const void *restrict elmt);
+
+/**
+ * @brief Insert the object at @a elmt as the first element in the @a ring
+ *
+ * @par Example
+ * @code{.c}
+ *   if (vector_ring_unshift(&ring, &job) == -1)
+ *     perror("vector_ring_unshift");
+ * @endcode
+ *
+ * This is vector_ring_push() except that the element is inserted before the
+ * head of the @a ring, which becomes its new head.
+ *
+ * @param ring the ring buffer to unshift onto
+ * @param elmt a pointer to the element to unshift, or @c NULL
+ * @return zero on success; otherwise -1
+ */
+__attribute__((nonnull(1), warn_unused_result))
+__vector_inline__ int vector_ring_unshift(
+    struct vector_ring *restrict ring, const void *restrict elmt);
+
+/**
+ * @brief Copy the last element in the @a ring to @a elmt and remove it
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_ring_pull(&ring, &job);
+ * @endcode
+ *
+ * If @a elmt is @c NULL then the element won't be copied before it's removed.
+ * The volume of the vector of the @a ring is never reduced.
+ *
+ * If the @a ring has no elements then the behavior is undefined.
+ *
+ * @param ring the ring buffer to pull from
+ * @param elmt the location to copy the element to or @c NULL
+ */
+__attribute__((nonnull(1)))
+__vector_inline__
+void vector_ring_pull(struct vector_ring *restrict ring, void *restrict elmt);
+
+/**
+ * @brief Copy the first element in the @a ring to @a elmt and remove it
+ *
+ * @par Example
+ * @code{.c}
+ *   while (vector_ring_length(&ring) != 0)
+ *     vector_ring_shift(&ring, &job);
+ * @endcode
+ *
+ * This is vector_ring_pull() except that the element is removed from the head
+ * of the @a ring, which is advanced past it.
+ *
+ * @param ring the ring buffer to shift from
+ * @param elmt the location to copy the element to or @c NULL
+ */
+__attribute__((nonnull(1)))
+__vector_inline__
+void vector_ring_shift(struct vector_ring *restrict ring, void *restrict elmt);
+
+/**
+ * @brief Rotate the elements of the @a ring to the start of its vector and
+ *   return it
+ *
+ * @par Example
+ * @code{.c}
+ *   vector = vector_ring_linearize(&ring);
+ *   vector_at(vector, i, sizeof(int));
+ * @endcode
+ *
+ * This makes the vector an ordinary vector with the elements at the indices
+ * that vector_ring_at() gave them. The volume of the vector is retained. The
+ * @a ring remains in use with its head at the start of the vector, and a
+ * subsequent operation through it invalidates the returned vector.
+ *
+ * If the elements wrap around the end of the volume then each element of the
+ * volume is moved to rotate them, and otherwise just the elements of the
+ * @a ring are.
+ *
+ * @param ring the ring buffer to linearize
+ * @return the vector of the @a ring
+ */
+__attribute__((nonnull, returns_nonnull))
+__vector_inline__ vector_t vector_ring_linearize(struct vector_ring *ring);
+
+/// @cond INTERNAL
+
+/// Grow the vector of the @a ring, which it fills, with its elements unwrapped
+/// into the added volume
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ int __vector_ring_grow(struct vector_ring *ring);
+
+/// Reverse the order of the @a n elements of size @a z at @a data
+__attribute__((nonnull))
+__vector_inline__ void __vector_ring_reverse(void *data, size_t n, size_t z);
+
+/// @endcond
+
+#endif /* VECTOR_RING_H */
+
+#if (-1- __vector_inline__ -1)
+#include "ring.c"
+#endif /* __vector_inline__ */
@@ -0,0 +1,60 @@
+/// @file header/vector/share.c
+
+#ifndef VECTOR_SHARE_C
+#define VECTOR_SHARE_C
+
+#include <stddef.h>
+
+#include "common.h"
+#include "share.h"
+#include "allocator.h"
+#include "create.h"
+
+__vector_inline__ vector_t vector_share_z(vector_t vector, size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+
+  // the empty vector is never modified or deallocated so it's shared as is
+  if (header == &__vector_empty)
+    return vector;
+
+  // storage that the vector doesn't own can't hold another reference to it
+  if (header->flags & (__VECTOR_LOCAL | __VECTOR_MAPPED))
+    return vector_duplicate_z(vector, z);
+
+  __atomic_fetch_add(&header->shares, 1, __ATOMIC_RELAXED);
+  return vector;
+}
+
+__vector_inline__ _Bool vector_shared(vector_c vector) {
+  const struct __vector_header_t *header = __vector_to_header(vector);
+  return __atomic_load_n(&header->shares, __ATOMIC_ACQUIRE) != 0;
+}
+
+__vector_inline__ vector_t vector_unshare_z(vector_t vector, size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+  vector_t duplicate;
+
+  // the empty vector is never shared (it's compared for just the compiler to
+  // see that it's never passed to free())
+  if (header == &__vector_empty)
+    return vector;
+  if (__atomic_load_n(&header->shares, __ATOMIC_ACQUIRE) == 0)
+    return vector;
+
+  if ((duplicate = vector_duplicate_z(vector, z)) == NULL)
+    return NULL;
+
+  // the duplicate replaces this reference, so it keeps its volume as the
+  // vector does; the empty vector is read-only but it has no volume to keep
+  if (header->flags & __VECTOR_KEEP
+      && __vector_to_header(duplicate) != &__vector_empty)
+    __vector_to_header(duplicate)->flags |= __VECTOR_KEEP;
+
+  // the other references may have been deleted in the meantime, which leaves
+  // this reference to deallocate the vector
+  if (__vector_share_release(header))
+    __vector_header_deallocate(header);
+  return duplicate;
+}
+
+#endif /* VECTOR_SHARE_C */
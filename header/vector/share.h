@@ -0,0 +1,153 @@
+/**
+ * @file header/vector/share.h
+ *
+ * A vector is shared by reference rather than duplicated with vector_share(),
+ * which just counts the new reference in the header of the vector, so that a
+ * snapshot of a vector that's seldom modified takes the same time regardless of
+ * its length:
+ *
+ * @code{.c}
+ *   vector_on(int) snapshot = vector_share(config);
+ *   ...
+ *   snapshot = vector_unshare(snapshot);
+ *   snapshot[0] = 1;
+ *   ...
+ *   vector_delete(snapshot);
+ * @endcode
+ *
+ * Each reference to a shared vector is deleted with vector_delete() as usual,
+ * which deallocates the vector only once its last reference is deleted. Each
+ * operation that would reallocate the vector or change its length, such as
+ * vector_inject(), vector_excise(), and vector_resize(), first replaces a
+ * shared vector with a duplicate of it, as vector_unshare() does, so that the
+ * other references to the vector are unchanged. An operation that modifies the
+ * elements of the vector in place, such as vector_set(), vector_swap(),
+ * vector_move(), vector_sort(), or an assignment to an element, can't replace
+ * the vector and so must be preceded by vector_unshare(). Each of those
+ * operations asserts that the vector isn't shared, so that a missing
+ * vector_unshare() aborts rather than modifies the other references.
+ *
+ * The count of references is updated atomically, so each reference may be used
+ * and deleted by a different thread. The vector itself is only safe to read
+ * from multiple threads while it remains shared.
+ */
+
+#ifndef VECTOR_SHARE_H
+#define VECTOR_SHARE_H
+
+#include <stddef.h>
+#include "common.h"
+
+/**
+ * @brief Return a reference to the @a vector that shares its data
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3);
+ *   vector_on(int) share = vector_share(vector);
+ *   // share == vector
+ * @endcode
+ *
+ * @param vector the vector to share
+ * @return the shared vector on success; otherwise @c NULL
+ *
+ * @see vector_share_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_share(vector_t vector)
+#define vector_share(v) vector_share_z((v), VECTOR_Z((v)))
+
+/**
+ * @brief Return a reference to the @a vector that shares its data
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) vector = vector_define(int, 1, 2, 3);
+ *   vector_on(int) share = vector_share_z(vector, sizeof(int));
+ *   // share == vector
+ * @endcode
+ *
+ * This counts a new reference to the @a vector and returns the @a vector
+ * itself, which must then be deleted once more before it's deallocated. The
+ * elements of the @a vector are neither allocated nor copied.
+ *
+ * A vector that's in storage that it doesn't own (see vector_create_local())
+ * or in a file (see vector_file_open()) can't outlive that storage, so this
+ * returns a duplicate of it by vector_duplicate_z() instead, which is allocated
+ * with malloc(). On failure of that the value of @c errno set by it will be
+ * retained.
+ *
+ * @param vector the vector to share
+ * @param z the element size of the @a vector
+ * @return the shared vector on success; otherwise @c NULL
+ *
+ * @see vector_share() - the implicit analogue to this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_share_z(vector_t vector, size_t z);
+
+/**
+ * @brief Return whether the @a vector has another reference to it by
+ *   vector_share()
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) share = vector_share(vector);
+ *   // vector_shared(vector) == 1
+ *
+ *   vector_delete(share);
+ *   // vector_shared(vector) == 0
+ * @endcode
+ */
+__attribute__((nonnull))
+__vector_inline__ _Bool vector_shared(vector_c vector);
+
+/**
+ * @brief Return the @a vector with no other reference to it
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) share = vector_share(vector);
+ *   share = vector_unshare(share);
+ *   share[0] = 4;
+ *   // vector[0] is unchanged
+ * @endcode
+ *
+ * @param vector the vector to unshare
+ * @return the unshared vector on success; otherwise @c NULL
+ *
+ * @see vector_unshare_z() - the explicit analogue to this operation
+ */
+//= vector_t vector_unshare(vector_t vector)
+#define vector_unshare(v) vector_unshare_z((v), VECTOR_Z((v)))
+
+/**
+ * @brief Return the @a vector with no other reference to it
+ *
+ * @par Example
+ * @code{.c}
+ *   vector_on(int) share = vector_share(vector);
+ *   share = vector_unshare_z(share, sizeof(int));
+ *   share[0] = 4;
+ *   // vector[0] is unchanged
+ * @endcode
+ *
+ * If the @a vector isn't shared then this just returns it. Otherwise this
+ * duplicates the @a vector with vector_duplicate_z(), releases this reference
+ * to the @a vector, and returns the duplicate; then the original @a vector is
+ * invalidated as by vector_delete(). On failure the @a vector is unmodified and
+ * the value of @c errno set by vector_duplicate_z() will be retained.
+ *
+ * @param vector the vector to unshare
+ * @param z the element size of the @a vector
+ * @return the unshared vector on success; otherwise @c NULL
+ *
+ * @see vector_unshare() - the implicit analogue to this operation
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t vector_unshare_z(vector_t vector, size_t z);
+
+#endif /* VECTOR_SHARE_H */
+
+#if (-1- __vector_inline__ -1)
+#include "share.c"
+#endif /* __vector_inline__ */
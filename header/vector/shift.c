@@ -3,12 +3,19 @@
 #ifndef VECTOR_SHIFT_C
 #define VECTOR_SHIFT_C
 
+#include <errno.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "common.h"
+#include "shift.h"
 #include "access.h"
+#include "allocator.h"
 #include "insert.h"
+#include "policy.h"
 #include "remove.h"
+#include "resize.h"
+#include "share.h"
 
 __vector_inline__
 vector_t vector_pull_z(vector_t vector, void *elmt, size_t z) {
@@ -21,14 +28,134 @@ __vector_inline__ vector_t vector_unshift_z(
     restrict vector_t vector,
     const void *restrict elmt,
     size_t z) {
-  return vector_insert_z(vector, 0, elmt, z);
+  struct __vector_header_t *header = __vector_to_header(vector);
+
+  // a vector in storage that it doesn't own stays in it while it has the
+  // volume, and the other references to a shared vector retain its header
+  // where it is
+  if (!__vector_headroom_fits(header, z) || header->flags & __VECTOR_MAPPED
+      || (header->flags & __VECTOR_LOCAL && header->length < header->volume)
+      || vector_shared(vector))
+    return vector_insert_z(vector, 0, elmt, z);
+
+  // the header is moved back over the headroom by as many multiples of the
+  // fundamental alignment as the element needs beyond the skew
+  size_t skew = __vector_skew(vector);
+  size_t step = skew < z ? __vector_headroom_step(z - skew) : 0;
+  if (__vector_headroom(header) < step) {
+    if ((vector = __vector_headroom_grow_z(vector, z)) == NULL)
+      return NULL;
+    header = __vector_to_header(vector);
+    step = __vector_headroom_step(z);
+  }
+
+  if (step != 0) {
+    header = memmove((char *) header - step, header, sizeof(*header));
+    header->offset -= step;
+  }
+  header->volume++;
+  header->length++;
+  vector = (char *) vector - z;
+
+  if (elmt != NULL)
+    memcpy(vector, elmt, z);
+  return vector;
 }
 
 __vector_inline__
 vector_t vector_shift_z(vector_t vector, void *elmt, size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+
   if (elmt != NULL)
     vector_get(vector, 0, elmt, z);
-  return vector_remove_z(vector, 0, z);
+
+  // the other references to a shared vector retain its header where it is
+  if (!__vector_headroom_fits(header, z) || header->flags & __VECTOR_MAPPED
+      || vector_shared(vector))
+    return vector_remove_z(vector, 0, z);
+
+  // the header is moved forward over the element by the multiples of the
+  // fundamental alignment that it spans, which leaves them as headroom, and the
+  // rest of the element is left as the skew of the vector
+  size_t step = __vector_skew(vector) + z;
+  step -= step % _Alignof(max_align_t);
+  if (step != 0) {
+    header = memmove((char *) header + step, header, sizeof(*header));
+    header->offset += step;
+  }
+  header->volume--;
+  header->length--;
+  vector = (char *) vector + z;
+
+  // the headroom is counted in the volume that the shrink policy reduces, and
+  // the resize drops it
+  size_t volume = header->volume + __vector_headroom(header) / z;
+  size_t shrunk = __vector_policy_shrink(header->length, volume, z);
+  if (shrunk != volume && !(header->flags & (__VECTOR_LOCAL | __VECTOR_KEEP))) {
+    vector_t resize = vector_resize_z(vector, shrunk, z);
+    if (resize != NULL)
+      vector = resize;
+  }
+
+  return vector;
+}
+
+__vector_inline__
+size_t __vector_headroom(const struct __vector_header_t *header) {
+  return header->offset - header->offset % header->alignment;
+}
+
+__vector_inline__
+_Bool __vector_headroom_fits(const struct __vector_header_t *header, size_t z) {
+  // the skew of a vector is less than the fundamental alignment, so the data
+  // of a vector of a greater alignment is aligned just if it's never skewed
+  return z != 0 && (header->alignment == _Alignof(max_align_t)
+      || z % header->alignment == 0);
+}
+
+__vector_inline__ size_t __vector_headroom_step(size_t size) {
+  size_t alignment = _Alignof(max_align_t);
+  return (size + alignment - 1) / alignment * alignment;
+}
+
+__vector_inline__ vector_t __vector_headroom_grow_z(vector_t vector, size_t z) {
+  struct __vector_header_t *header = __vector_to_header(vector);
+  struct __vector_header_t *result;
+  size_t length = header->length;
+  size_t volume = length < header->volume ? header->volume : length + 1;
+  size_t room, size;
+
+  // the headroom is as many elements as the growth policy would add at the
+  // tail, rounded up to a multiple of the alignment of the vector, with the
+  // volume at the tail retained
+  room = __vector_policy_grow(length + 1, z) - length;
+  if (__builtin_mul_overflow(room, z, &room))
+    return errno = ENOMEM, NULL;
+  if (__builtin_add_overflow(room, header->alignment - 1, &room))
+    return errno = ENOMEM, NULL;
+  room -= room % header->alignment;
+  if (__builtin_mul_overflow(volume, z, &size))
+    return errno = ENOMEM, NULL;
+  if (__builtin_add_overflow(size, room, &size))
+    return errno = ENOMEM, NULL;
+  if (__builtin_add_overflow(size, sizeof(*header), &size))
+    return errno = ENOMEM, NULL;
+
+  result = __vector_header_allocate(header->allocator, header->alignment, size);
+  if (result == NULL)
+    return NULL;
+
+  // the header is placed after the headroom
+  result = memmove((char *) result + room, result, sizeof(*result));
+  result->offset += room;
+  result->flags = header->flags & __VECTOR_KEEP;
+  result->volume = volume;
+  result->length = length;
+  memcpy(result->data, vector, length * z);
+
+  if (!(header == &__vector_empty || header->flags & __VECTOR_LOCAL))
+    __vector_header_deallocate(header);
+  return result->data;
 }
 
 #endif /* VECTOR_SHIFT_C */
@@ -41,7 +41,7 @@
  *
  * @param vector the vector to operate on
  * @param elmt the location to copy the element to or @c NULL
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 //= vector_t vector_pull(vector_t vector, void *elmt)
 #define vector_pull(v, ...) vector_pull_z((v), __VA_ARGS__, VECTOR_Z((v)))
@@ -64,7 +64,7 @@
  * @param vector the vector to operate on
  * @param elmt the location to copy the element to or @c NULL
  * @param z the element size of the @a vector
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 __vector_inline__ vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
   __attribute__((nonnull(1), warn_unused_result));
@@ -79,6 +79,9 @@ __vector_inline__ vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
  * vector_ensure(). If that fails then the @a vector will be unmodified and the
  * value of @c errno set by realloc() will be retained.
  *
+ * The other elements are left in place, rather than moved, where the @a vector
+ * has headroom before it (see vector_unshift_z()).
+ *
  * If @a elmt isn't @c NULL and its type is incompatible with the element type
  * of the @a vector then the behavior is undefined. If @a elmt is a location in
  * the @a vector itself then the behavior is undefined.
@@ -102,6 +105,18 @@ __vector_inline__ vector_t vector_pull_z(vector_t vector, void *elmt, size_t z)
  * vector_ensure(). If that fails then the @a vector will be unmodified and the
  * value of @c errno set by realloc() will be retained.
  *
+ * The element is inserted into the headroom before the first element, which
+ * vector_shift_z() leaves, without the other elements being moved. If the
+ * @a vector has no headroom then it's moved to an allocation with as much
+ * headroom as vector_ensure_z() would add volume at its tail, so a run of
+ * unshifts takes an amortized constant time each. If that allocation fails
+ * then the @a vector will be unmodified and the value of @c errno set by
+ * malloc() will be retained. A vector in a file mapping, in storage that it
+ * doesn't own while that has the volume, or that's shared by vector_share(),
+ * has its elements moved instead, as does a vector of a greater alignment than
+ * the fundamental alignment (see vector_create_aligned()) unless @a z is a
+ * multiple of it.
+ *
  * If @a elmt isn't @c NULL and its type is incompatible with the element type
  * of the @a vector then the behavior is undefined. If @a elmt is a location in
  * the @a vector itself then the behavior is undefined.
@@ -134,12 +149,15 @@ __vector_inline__ vector_t vector_unshift_z(
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
+ * The subsequent elements are left in place rather than shifted, so this takes
+ * a constant time where the @a vector allows it (see vector_shift_z()).
+ *
  * If no first element is in the @a vector (the @a vector's length is zero) then
  * the behavior is undefined.
  *
  * @param vector the vector to operate on
  * @param elmt the location to copy the element to or @c NULL
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 //= vector_t vector_shift(vector_t vector, void *elmt)
 #define vector_shift(v, ...) vector_shift_z((v), __VA_ARGS__, VECTOR_Z((v)))
@@ -159,17 +177,60 @@ __vector_inline__ vector_t vector_unshift_z(
  * On success the shrunk vector will be returned. Otherwise the vector will be
  * returned as is (without the element).
  *
+ * The subsequent elements aren't moved. Instead the start of the @a vector is
+ * advanced past the element, which is left as headroom for vector_unshift_z(),
+ * so this takes a constant time. The header of the @a vector is moved just by
+ * multiples of the fundamental alignment, so once the @a vector is shifted its
+ * first element may be less than that alignment after where it would be
+ * otherwise, which still aligns it for its element type. The headroom is
+ * counted in the @volume that the shrink above compares the @length to, and
+ * it's dropped by the next reallocation of the @a vector. A vector in a file
+ * mapping, or that's shared by vector_share(), has its elements moved instead,
+ * as does a vector of a greater alignment than the fundamental alignment (see
+ * vector_create_aligned()) unless @a z is a multiple of it.
+ *
  * If no first element is in the @a vector (the @a vector's length is zero) then
  * the behavior is undefined.
  *
  * @param vector the vector to operate on
  * @param elmt the location to copy the element to or @c NULL
  * @param z the element size of the @a vector
- * @return the resultant vector
+ * @return the resultant vector on success; otherwise @c NULL
  */
 __vector_inline__ vector_t vector_shift_z(vector_t vector, void *elmt, size_t z)
   __attribute__((nonnull(1), warn_unused_result));
 
+/// @cond INTERNAL
+
+/// Return the number of bytes of headroom before the @a header
+__attribute__((nonnull, pure))
+__vector_inline__
+size_t __vector_headroom(const struct __vector_header_t *header);
+
+/// Return whether the elements of size @a z of the vector of the @a header can
+/// be shifted through headroom
+__attribute__((nonnull, pure))
+__vector_inline__
+_Bool __vector_headroom_fits(const struct __vector_header_t *header, size_t z);
+
+/// Return @a size rounded up to a multiple of the fundamental alignment, which
+/// is the headroom that a header is moved by for that many bytes
+__attribute__((const))
+__vector_inline__ size_t __vector_headroom_step(size_t size);
+
+/**
+ * @brief Move the @a vector to an allocation with headroom before it for at
+ *   least one more element
+ *
+ * The @a vector is deallocated unless it's in storage that it doesn't own. If
+ * the allocation fails then this returns @c NULL with the @a vector
+ * unmodified.
+ */
+__attribute__((nonnull, warn_unused_result))
+__vector_inline__ vector_t __vector_headroom_grow_z(vector_t vector, size_t z);
+
+/// @endcond
+
 #endif /* VECTOR_SHIFT_H */
 
 #if (-1- __vector_inline__ -1)
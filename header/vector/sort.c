@@ -3,14 +3,19 @@
 #ifndef VECTOR_SORT_C
 #define VECTOR_SORT_C
 
+#include <assert.h>
 #include <stddef.h>
 #include <stdlib.h>
 
 #include "common.h"
 #include "sort.h"
+#include "share.h"
 
 __vector_inline__ void vector_sort_z(
     vector_t vector, int (*cmp)(const void *a, const void *b), size_t z) {
+  // the other references to a shared vector would see the elements reorder
+  assert(!vector_shared(vector));
+
   qsort(vector, vector_length(vector), z, cmp);
 }
 
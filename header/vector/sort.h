@@ -42,6 +42,9 @@
  * This isn't a stable sort: if @a cmp indicates that two elements are equal,
  * their relative order in the result is unspecified.
  *
+ * The @a vector mustn't be shared by vector_share(), which is asserted, as the
+ * other references to it would be modified (see vector_unshare()).
+ *
  * @param vector the vector to operate on
  * @param cmp @parblock
  *   The comparator that will be used to establish the relative order of two
@@ -0,0 +1,17 @@
+/// @file source/vector/allocator.c
+
+#include <vector/allocator.c>
+
+extern __typeof__(vector_allocator) vector_allocator;
+extern __typeof__(__vector_allocate) __vector_allocate;
+extern __typeof__(__vector_reallocate) __vector_reallocate;
+extern __typeof__(__vector_deallocate) __vector_deallocate;
+extern __typeof__(vector_alignment) vector_alignment;
+extern __typeof__(__vector_header_allocate) __vector_header_allocate;
+extern __typeof__(__vector_header_reallocate) __vector_header_reallocate;
+extern __typeof__(__vector_header_reallocate_zeroed)
+  __vector_header_reallocate_zeroed;
+extern __typeof__(__vector_header_deallocate) __vector_header_deallocate;
+extern __typeof__(__vector_usable) __vector_usable;
+extern __typeof__(__vector_header_usable) __vector_header_usable;
+extern __typeof__(__vector_share_release) __vector_share_release;
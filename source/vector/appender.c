@@ -0,0 +1,10 @@
+/// @file source/vector/appender.c
+
+#include <vector/appender.c>
+
+extern __typeof__(vector_appender_begin_z) vector_appender_begin_z;
+extern __typeof__(vector_appender_length) vector_appender_length;
+extern __typeof__(vector_appender_push) vector_appender_push;
+extern __typeof__(vector_appender_extend) vector_appender_extend;
+extern __typeof__(vector_appender_commit) vector_appender_commit;
+extern __typeof__(__vector_appender_grow) __vector_appender_grow;
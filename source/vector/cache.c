@@ -0,0 +1,12 @@
+/// @file source/vector/cache.c
+
+#include <vector/cache.c>
+
+_Thread_local struct vector_cache __vector_cache = { 0 };
+
+extern __typeof__(vector_cache) vector_cache;
+extern __typeof__(vector_cache_enable) vector_cache_enable;
+extern __typeof__(vector_cache_disable) vector_cache_disable;
+extern __typeof__(__vector_cache_bucket) __vector_cache_bucket;
+extern __typeof__(__vector_cache_take) __vector_cache_take;
+extern __typeof__(__vector_cache_give) __vector_cache_give;
@@ -1,6 +1,16 @@
 /// @file source/vector/common.c
 
-#include <vector/common.h>
+#include <vector/common.c>
+
+const struct __vector_header_t __vector_empty = {
+  .volume = 0,
+  .length = 0,
+  .allocator = NULL,
+  .offset = 0,
+  .alignment = _Alignof(max_align_t),
+  .flags = __VECTOR_LOCAL,
+};
 
 extern __typeof__(vector_volume) vector_volume;
 extern __typeof__(vector_length) vector_length;
+extern __typeof__(__vector_set_length) __vector_set_length;
@@ -3,5 +3,11 @@
 #include <vector/create.c>
 
 extern __typeof__(vector_create) vector_create;
+extern __typeof__(vector_create_in) vector_create_in;
+extern __typeof__(vector_create_with_z) vector_create_with_z;
+extern __typeof__(vector_create_aligned) vector_create_aligned;
+extern __typeof__(vector_create_aligned_in) vector_create_aligned_in;
+extern __typeof__(vector_create_local) vector_create_local;
 extern __typeof__(vector_import_z) vector_import_z;
+extern __typeof__(vector_import_in_z) vector_import_in_z;
 extern __typeof__(vector_duplicate_z) vector_duplicate_z;
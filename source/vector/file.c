@@ -0,0 +1,7 @@
+/// @file source/vector/file.c
+
+// The _GNU_SOURCE feature test macro must be defined in order to obtain the
+// definitions of mremap() and MREMAP_MAYMOVE from <sys/mman.h>
+#define _GNU_SOURCE
+
+#include <vector/file.c>
@@ -0,0 +1,13 @@
+/// @file source/vector/gap.c
+
+#include <vector/gap.c>
+
+extern __typeof__(vector_gap_begin_z) vector_gap_begin_z;
+extern __typeof__(vector_gap_length) vector_gap_length;
+extern __typeof__(vector_gap_at) vector_gap_at;
+extern __typeof__(vector_gap_insert) vector_gap_insert;
+extern __typeof__(vector_gap_inject) vector_gap_inject;
+extern __typeof__(vector_gap_excise) vector_gap_excise;
+extern __typeof__(vector_gap_materialize) vector_gap_materialize;
+extern __typeof__(__vector_gap_open) __vector_gap_open;
+extern __typeof__(__vector_gap_move) __vector_gap_move;
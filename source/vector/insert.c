@@ -4,5 +4,8 @@
 
 extern __typeof__(vector_insert_z) vector_insert_z;
 extern __typeof__(vector_inject_z) vector_inject_z;
+extern __typeof__(vector_inject_zeroed_z) vector_inject_zeroed_z;
+extern __typeof__(vector_inject_many_z) vector_inject_many_z;
 extern __typeof__(vector_append_z) vector_append_z;
 extern __typeof__(vector_extend_z) vector_extend_z;
+extern __typeof__(vector_emplace_back_z) vector_emplace_back_z;
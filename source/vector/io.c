@@ -0,0 +1,3 @@
+/// @file source/vector/io.c
+
+#include <vector/io.c>
@@ -0,0 +1,7 @@
+/// @file source/vector/map.c
+
+// The _GNU_SOURCE feature test macro must be defined in order to obtain the
+// definitions of mremap(), MREMAP_MAYMOVE, and MREMAP_FIXED from <sys/mman.h>
+#define _GNU_SOURCE
+
+#include <vector/map.c>
@@ -0,0 +1,13 @@
+/// @file source/vector/policy.c
+
+#include <vector/policy.c>
+
+_Thread_local const struct vector_policy *__vector_policy = NULL;
+
+extern __typeof__(vector_policy) vector_policy;
+extern __typeof__(vector_policy_set) vector_policy_set;
+extern __typeof__(vector_policy_keep) vector_policy_keep;
+extern __typeof__(__vector_policy_scale) __vector_policy_scale;
+extern __typeof__(__vector_policy_round) __vector_policy_round;
+extern __typeof__(__vector_policy_grow) __vector_policy_grow;
+extern __typeof__(__vector_policy_shrink) __vector_policy_shrink;
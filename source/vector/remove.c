@@ -5,3 +5,11 @@
 extern __typeof__(vector_remove_z) vector_remove_z;
 extern __typeof__(vector_excise_z) vector_excise_z;
 extern __typeof__(vector_truncate_z) vector_truncate_z;
+extern __typeof__(vector_truncate_keep_z) vector_truncate_keep_z;
+extern __typeof__(vector_clear_z) vector_clear_z;
+extern __typeof__(vector_remove_if_z) vector_remove_if_z;
+extern __typeof__(vector_remove_indices_z) vector_remove_indices_z;
+extern __typeof__(vector_remove_bitmap_z) vector_remove_bitmap_z;
+extern __typeof__(vector_remove_unordered_z) vector_remove_unordered_z;
+extern __typeof__(vector_excise_unordered_z) vector_excise_unordered_z;
+extern __typeof__(__vector_reduce_z) __vector_reduce_z;
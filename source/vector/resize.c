@@ -4,4 +4,6 @@
 
 extern __typeof__(vector_resize_z) vector_resize_z;
 extern __typeof__(vector_ensure_z) vector_ensure_z;
+extern __typeof__(vector_reserve_z) vector_reserve_z;
 extern __typeof__(vector_shrink_z) vector_shrink_z;
+extern __typeof__(vector_resize_zeroed_z) vector_resize_zeroed_z;
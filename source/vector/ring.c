@@ -0,0 +1,14 @@
+/// @file source/vector/ring.c
+
+#include <vector/ring.c>
+
+extern __typeof__(vector_ring_begin_z) vector_ring_begin_z;
+extern __typeof__(vector_ring_length) vector_ring_length;
+extern __typeof__(vector_ring_at) vector_ring_at;
+extern __typeof__(vector_ring_push) vector_ring_push;
+extern __typeof__(vector_ring_unshift) vector_ring_unshift;
+extern __typeof__(vector_ring_pull) vector_ring_pull;
+extern __typeof__(vector_ring_shift) vector_ring_shift;
+extern __typeof__(vector_ring_linearize) vector_ring_linearize;
+extern __typeof__(__vector_ring_grow) __vector_ring_grow;
+extern __typeof__(__vector_ring_reverse) __vector_ring_reverse;
@@ -0,0 +1,7 @@
+/// @file source/vector/share.c
+
+#include <vector/share.c>
+
+extern __typeof__(vector_share_z) vector_share_z;
+extern __typeof__(vector_shared) vector_shared;
+extern __typeof__(vector_unshare_z) vector_unshare_z;
@@ -5,3 +5,7 @@
 extern __typeof__(vector_pull_z) vector_pull_z;
 extern __typeof__(vector_unshift_z) vector_unshift_z;
 extern __typeof__(vector_shift_z) vector_shift_z;
+extern __typeof__(__vector_headroom) __vector_headroom;
+extern __typeof__(__vector_headroom_fits) __vector_headroom_fits;
+extern __typeof__(__vector_headroom_step) __vector_headroom_step;
+extern __typeof__(__vector_headroom_grow_z) __vector_headroom_grow_z;
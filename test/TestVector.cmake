@@ -5,6 +5,7 @@ endforeach (module)
 define_test(vector_define)
 define_test(vector_duplicate)
 define_test(vector_ensure)
+define_test(vector_reserve)
 define_test(vector_shrink)
 define_test(vector_swap)
 
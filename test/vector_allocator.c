@@ -0,0 +1,193 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+struct count {
+  size_t allocate;
+  size_t reallocate;
+  size_t deallocate;
+  int error;
+};
+
+static void *count_allocate(size_t size, void *data) {
+  struct count *count = data;
+  count->allocate++;
+  if (count->error != 0)
+    return errno = count->error, NULL;
+  return malloc(size);
+}
+
+static void *count_reallocate(void *object, size_t size, void *data) {
+  struct count *count = data;
+  count->reallocate++;
+  if (count->error != 0)
+    return errno = count->error, NULL;
+  return realloc(object, size);
+}
+
+static void count_deallocate(void *object, void *data) {
+  struct count *count = data;
+  count->deallocate++;
+  free(object);
+}
+
+static struct count count;
+static const struct vector_allocator allocator = {
+  .allocate = count_allocate,
+  .reallocate = count_reallocate,
+  .deallocate = count_deallocate,
+  .data = &count,
+};
+
+void test_vector_allocator(void) {
+  int *vector;
+
+  // A vector created without an allocator has a NULL allocator
+  vector = vector_create();
+  assert(vector_allocator(vector) == NULL);
+  vector_delete(vector);
+
+  // A vector created with an allocator has that allocator
+  vector = vector_create_in(&allocator);
+  assert(vector_allocator(vector) == &allocator);
+  vector_delete(vector);
+}
+
+// An allocator that allocates at least a block of 1024 bytes for each object
+static void *block_allocate(size_t size, void *data) {
+  (void) data;
+  return malloc(size < 1024 ? 1024 : size);
+}
+
+static void *block_reallocate(void *object, size_t size, void *data) {
+  (void) data;
+  return realloc(object, size < 1024 ? 1024 : size);
+}
+
+static void block_deallocate(void *object, void *data) {
+  (void) data;
+  free(object);
+}
+
+static size_t block_usable(void *object, void *data) {
+  (void) object, (void) data;
+  return 1024;
+}
+
+static const struct vector_allocator block = {
+  .allocate = block_allocate,
+  .reallocate = block_reallocate,
+  .deallocate = block_deallocate,
+  .usable = block_usable,
+};
+
+void test_vector_usable(void) {
+  size_t header = sizeof(struct __vector_header_t);
+  int *vector;
+
+  // vector_ensure() records the usable size of the allocation as the volume
+  vector = vector_create_in(&block);
+  vector = vector_ensure(vector, 10);
+  assert(vector_volume(vector) == (1024 - header) / sizeof(int));
+
+  // vector_resize() records just the volume that it's given
+  vector = vector_resize(vector, 10);
+  assert(vector_volume(vector) == 10);
+
+  vector_delete(vector);
+
+  // Without a usable function vector_ensure() records the volume it asked for
+  vector = vector_create_in(&allocator);
+  vector = vector_ensure(vector, 10);
+  assert(vector_volume(vector) == 16);
+  vector_delete(vector);
+
+  // With malloc() the volume is at least the volume asked for
+  vector = vector_create();
+  vector = vector_ensure(vector, 10);
+  assert(vector_volume(vector) >= 16);
+  vector_delete(vector);
+}
+
+void test_vector_create_in(void) {
+  int *vector;
+
+  count = (struct count) { 0 };
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from the allocator
+  count.error = ENOENT;
+  errno = 0;
+  assert(vector_create_in(&allocator) == NULL);
+  assert(errno == ENOENT);
+  count.error = 0;
+
+  // It allocates, reallocates, and deallocates the vector with the allocator
+  count = (struct count) { 0 };
+  vector = vector_create_in(&allocator);
+  assert(count.allocate == 1);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 0);
+
+  vector = vector_extend(vector, ((int[]) { 1, 2, 3, 5 }), 4);
+  assert(count.reallocate == 1);
+  assert_vector_data(vector, 1, 2, 3, 5);
+
+  vector_delete(vector);
+  assert(count.deallocate == 1);
+}
+
+void test_vector_import_in(void) {
+  int data[] = { 1, 2, 3, 5, 8, 13, 21, 34 };
+  size_t length = sizeof(data) / sizeof(data[0]);
+  int *vector;
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from the allocator
+  count = (struct count) { .error = ENOENT };
+  errno = 0;
+  assert(vector_import_in(&allocator, data, length) == NULL);
+  assert(errno == ENOENT);
+
+  // It allocates the vector with the allocator
+  count = (struct count) { 0 };
+  vector = vector_import_in(&allocator, data, length);
+  assert(count.allocate == 1);
+  assert(vector_allocator(vector) == &allocator);
+  assert(vector_length(vector) == length);
+  assert(vector_volume(vector) == length);
+  for (size_t i = 0; i < vector_length(vector); i++)
+    assert(vector[i] == data[i]);
+
+  vector_delete(vector);
+  assert(count.deallocate == 1);
+}
+
+void test_vector_duplicate(void) {
+  int *source;
+  int *target;
+
+  // It allocates the duplicate with the allocator of the source
+  count = (struct count) { 0 };
+  source = vector_import_in(&allocator, ((int[]) { 1, 2, 3, 5 }), 4);
+  target = vector_duplicate(source);
+  assert(count.allocate == 2);
+  assert(vector_allocator(target) == &allocator);
+  assert_vector_data(target, 1, 2, 3, 5);
+
+  vector_delete(target);
+  vector_delete(source);
+  assert(count.deallocate == 2);
+}
+
+int main() {
+  test_vector_allocator();
+  test_vector_create_in();
+  test_vector_import_in();
+  test_vector_duplicate();
+  test_vector_usable();
+}
@@ -0,0 +1,96 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int realloc_errno = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  if (realloc_errno != 0)
+    return errno = realloc_errno, NULL;
+  return realloc(data, size);
+}
+
+void test_vector_appender_push(void) {
+  int *vector = vector_define(int, 1, 2, 3);
+  struct vector_appender appender;
+
+  assert(vector_appender_begin(&appender, vector) == 0);
+  assert(vector_appender_length(&appender) == 3);
+
+  // It appends elements beyond the length of the vector until committed
+  for (int i = 4; i < 100; i++)
+    assert(vector_appender_push(&appender, &i) == 0);
+  assert(vector_appender_length(&appender) == 99);
+  assert(vector_length(appender.vector) < 99);
+
+  // It commits the appended elements to the length of the vector
+  vector = vector_appender_commit(&appender);
+  assert(vector_length(vector) == 99);
+  for (int i = 0; i < 99; i++)
+    assert(vector[i] == i + 1);
+
+  // It appends more elements after a commit
+  int data[] = { 100, 101, 102 };
+  assert(vector_appender_extend(&appender, data, 3) == 0);
+  assert(vector_appender_push(&appender, NULL) == 0);
+  vector = vector_appender_commit(&appender);
+  assert(vector_length(vector) == 103);
+  assert(vector[99] == 100 && vector[101] == 102);
+
+  vector_delete(vector);
+}
+
+void test_vector_appender_fail(void) {
+  int *vector = vector_define(int, 1, 2);
+  struct vector_appender appender;
+
+  vector = vector_shrink(vector);
+  assert(vector_appender_begin(&appender, vector) == 0);
+
+  // When the growth fails it returns -1 with errno retained from realloc()
+  realloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_appender_push(&appender, &(int) { 3 }) == -1);
+  assert(errno == ENOENT);
+  realloc_errno = 0;
+  assert(vector_appender_length(&appender) == 2);
+
+  // With a length that overflows a size_t it returns -1 with errno = ENOMEM
+  errno = 0;
+  assert(vector_appender_extend(&appender, NULL, SIZE_MAX) == -1);
+  assert(errno == ENOMEM);
+  vector = vector_appender_commit(&appender);
+  assert_vector_data(vector, 1, 2);
+  vector_delete(vector);
+
+  // It begins from the empty vector
+  vector = vector_create();
+  assert(vector_appender_begin(&appender, vector) == 0);
+  assert(vector_appender_commit(&appender) == vector);
+  assert(vector_appender_push(&appender, &(int) { 1 }) == 0);
+  vector = vector_appender_commit(&appender);
+  assert_vector_data(vector, 1);
+  vector_delete(vector);
+
+  // It begins a vector that's shared by unsharing it
+  vector = vector_define(int, 1, 2);
+  int *share = vector_share(vector);
+  assert(vector_appender_begin(&appender, share) == 0);
+  assert(appender.vector != vector);
+  assert(vector_appender_push(&appender, &(int) { 3 }) == 0);
+  share = vector_appender_commit(&appender);
+  assert_vector_data(share, 1, 2, 3);
+  assert_vector_data(vector, 1, 2);
+
+  vector_delete(share);
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_appender_push();
+  test_vector_appender_fail();
+}
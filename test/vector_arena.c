@@ -0,0 +1,121 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int malloc_errno = 0;
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  malloc_count++;
+  if (malloc_errno != 0)
+    return errno = malloc_errno, NULL;
+  return malloc(size);
+}
+
+void test_vector_arena_create(void) {
+  struct vector_arena *arena;
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from malloc()
+  malloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_arena_create(1024) == NULL);
+  assert(errno == ENOENT);
+  malloc_errno = 0;
+
+  // It allocates the arena and its initial region
+  malloc_count = 0;
+  arena = vector_arena_create(1024);
+  assert(arena != NULL);
+  assert(malloc_count == 2);
+  assert(arena->allocator.data == arena);
+
+  // It returns NULL on deletion
+  assert(vector_arena_delete(arena) == NULL);
+}
+
+void test_vector_arena_allocate(void) {
+  struct vector_arena *arena = vector_arena_create(1024);
+  int *a;
+  int *b;
+
+  // It creates vectors from the arena without a call to malloc()
+  malloc_count = 0;
+  a = vector_create_in(&arena->allocator);
+  b = vector_import_in(&arena->allocator, ((int[]) { 1, 2, 3, 5 }), 4);
+  assert(malloc_count == 0);
+  assert(vector_allocator(a) == &arena->allocator);
+  assert(vector_allocator(b) == &arena->allocator);
+  assert_vector_data(b, 1, 2, 3, 5);
+
+  // Each vector is suitably aligned
+  assert((size_t) a % _Alignof(max_align_t) == 0);
+  assert((size_t) b % _Alignof(max_align_t) == 0);
+
+  // When the vector is the last object it's extended in place
+  int *result = vector_extend(b, ((int[]) { 8, 13 }), 2);
+  assert(result == b);
+  b = result;
+  assert_vector_data(b, 1, 2, 3, 5, 8, 13);
+
+  // When the vector isn't the last object it's moved with its elements
+  result = vector_extend(a, ((int[]) { 21, 34 }), 2);
+  assert(result != a);
+  a = result;
+  assert_vector_data(a, 21, 34);
+  assert_vector_data(b, 1, 2, 3, 5, 8, 13);
+
+  // When the region is exhausted another region is allocated
+  malloc_count = 0;
+  int *c = vector_create_in(&arena->allocator);
+  c = vector_resize(c, 1024);
+  assert(malloc_count == 1);
+  assert(vector_volume(c) == 1024);
+  assert_vector_data(a, 21, 34);
+
+  vector_delete(c);
+  vector_delete(b);
+  vector_delete(a);
+
+  vector_arena_delete(arena);
+}
+
+void test_vector_arena_reset(void) {
+  struct vector_arena *arena = vector_arena_create(0);
+  int *vector;
+
+  // It allocates regions on demand when created with no initial region
+  malloc_count = 0;
+  for (size_t i = 0; i < 8; i++) {
+    vector = vector_create_in(&arena->allocator);
+    vector = vector_resize(vector, 64);
+  }
+  assert(malloc_count > 1);
+
+  // After a reset it retains its last region
+  vector_arena_reset(arena);
+
+  malloc_count = 0;
+  vector = vector_create_in(&arena->allocator);
+  vector = vector_resize(vector, 64);
+  assert(malloc_count == 0);
+  vector_delete(vector);
+
+  // When the last object is deleted its space is reused
+  int *a = vector_create_in(&arena->allocator);
+  vector_delete(a);
+  int *b = vector_create_in(&arena->allocator);
+  assert(a == b);
+  vector_delete(b);
+
+  vector_arena_delete(arena);
+}
+
+int main() {
+  test_vector_arena_create();
+  test_vector_arena_allocate();
+  test_vector_arena_reset();
+}
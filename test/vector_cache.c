@@ -0,0 +1,199 @@
+#include <assert.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static const int data[] = { 1, 2, 3 };
+
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  malloc_count++;
+  return malloc(size);
+}
+
+static size_t realloc_count = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  realloc_count++;
+  return realloc(data, size);
+}
+
+static size_t free_count = 0;
+__attribute__((used)) void stub_free(void *data) {
+  free_count++;
+  free(data);
+}
+
+void test_vector_cache_enable(void) {
+  const struct vector_cache *cache = vector_cache();
+
+  // The calling thread initially has its cache disabled
+  assert(cache->ceiling == 0);
+  assert(cache->size == 0);
+
+  // When the cache is disabled it deallocates a deleted vector
+  int *vector = vector_import(data, 3);
+  assert(vector_cache()->misses == 0);
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+
+  // It sets the ceiling and resets the counters
+  vector_cache_enable(4096);
+  assert(cache->ceiling == 4096);
+  assert(cache->hits == 0 && cache->misses == 0);
+
+  vector_cache_disable();
+  assert(cache->ceiling == 0);
+}
+
+void test_vector_cache_recycle(void) {
+  const struct vector_cache *cache = vector_cache();
+
+  vector_cache_enable(4096);
+
+  // It rounds an allocation up to a power of two
+  malloc_count = 0;
+  int *vector = vector_import(data, 3);
+  size_t size = sizeof(struct __vector_header_t) + 3 * sizeof(int);
+  assert(malloc_count == 1);
+  assert(cache->misses == 1);
+
+  // It returns the allocation to the cache on deletion
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 0);
+  assert(cache->size == 64 && size <= 64);
+
+  // It takes the allocation from the cache for a vector of the same size class
+  malloc_count = 0;
+  vector = vector_create_with(int, 2);
+  assert(malloc_count == 0);
+  assert(cache->hits == 1);
+  assert(cache->size == 0);
+
+  // It doesn't reallocate a vector that grows within its size class
+  realloc_count = 0;
+  vector = vector_resize(vector, 4);
+  for (int i = 0; i < 4; i++)
+    vector = vector_append(vector, &i);
+  assert(realloc_count == 0);
+  assert(cache->misses == 1);
+  assert_vector_data(vector, 0, 1, 2, 3);
+
+  // It reallocates a vector that grows beyond its size class
+  for (int i = 4; i < 100; i++)
+    vector = vector_append(vector, &i);
+  assert(realloc_count != 0);
+  for (int i = 0; i < 100; i++)
+    assert(vector[i] == i);
+
+  // It takes an allocation for a duplicate from the cache
+  int *duplicate = vector_duplicate(vector);
+  vector_delete(duplicate);
+  malloc_count = 0;
+  duplicate = vector_duplicate(vector);
+  assert(malloc_count == 0);
+  assert(!memcmp(duplicate, vector, 100 * sizeof(int)));
+
+  vector_delete(duplicate);
+  vector_delete(vector);
+  free_count = 0;
+  vector_cache_disable();
+  assert(free_count != 0);
+  assert(cache->size == 0);
+}
+
+void test_vector_cache_ceiling(void) {
+  const struct vector_cache *cache = vector_cache();
+
+  vector_cache_enable(256);
+
+  // It deallocates an allocation that would exceed the ceiling
+  int *a = vector_create_with(int, 40);
+  int *b = vector_create_with(int, 40);
+  free_count = 0;
+  vector_delete(a);
+  assert(free_count == 0);
+  assert(cache->size == 256);
+  vector_delete(b);
+  assert(free_count == 1);
+  assert(cache->size == 256);
+
+  // It deallocates the allocations that exceed a lower ceiling
+  free_count = 0;
+  vector_cache_enable(128);
+  assert(free_count == 1);
+  assert(cache->size == 0);
+
+  vector_cache_disable();
+}
+
+void test_vector_cache_aligned(void) {
+  vector_cache_enable(4096);
+
+  // It doesn't cache a vector with an alignment or an allocator
+  int *vector = vector_create_aligned(64);
+  vector = vector_resize(vector, 10);
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+  assert(vector_cache()->size == 0);
+
+  // It deallocates a vector that was allocated before the cache was enabled
+  vector_cache_disable();
+  vector = vector_create_with(int, 10);
+  vector_cache_enable(4096);
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+
+  // It deallocates a vector that was cached after the cache was disabled
+  vector = vector_create_with(int, 10);
+  vector_cache_disable();
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+}
+
+void test_vector_cache_max(void) {
+  const struct vector_cache *cache = vector_cache();
+  size_t max = __VECTOR_CACHE_MAX;
+
+  vector_cache_enable(4 * max);
+
+  // It allocates a vector beyond the largest size class with malloc()
+  malloc_count = 0;
+  char *vector = vector_create_with(char, max);
+  assert(malloc_count == 1);
+  assert(cache->misses == 0);
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+  assert(cache->size == 0);
+
+  // It reallocates a vector that grows beyond the largest size class and
+  // deallocates it rather than cache it
+  vector = vector_create_with(char, max / 2);
+  assert(cache->misses == 1);
+  realloc_count = 0;
+  vector = vector_resize(vector, max);
+  assert(realloc_count == 1);
+  assert(cache->misses == 1);
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+  assert(cache->size == 0);
+
+  vector_cache_disable();
+}
+
+int main() {
+  test_vector_cache_enable();
+  test_vector_cache_recycle();
+  test_vector_cache_ceiling();
+  test_vector_cache_aligned();
+  test_vector_cache_max();
+}
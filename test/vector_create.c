@@ -8,7 +8,9 @@
 #include "test.h"
 
 static int malloc_errno = 0;
+static size_t malloc_count = 0;
 __attribute__((used)) void *stub_malloc(size_t size) {
+  malloc_count++;
   if (malloc_errno != 0)
     return errno = malloc_errno, NULL;
   return malloc(size);
@@ -20,20 +22,204 @@ vector_t vector_import_z(const void *data, size_t length, size_t z) {
 }
 
 void test_vector_create(void) {
+  // It returns a vector with length = 0 and volume = 0 without a call to
+  // malloc(), so it doesn't fail
+  malloc_count = 0;
+  malloc_errno = ENOENT;
+  int *vector = vector_create();
+  assert(vector != NULL);
+  assert(malloc_count == 0);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 0);
+
+  malloc_errno = 0;
+
+  // Each vector it returns shares the empty header
+  int *other = vector_create();
+  assert(other == vector);
+
+  // Operations that don't grow the vector don't write to or allocate it
+  other = vector_resize(other, 0);
+  other = vector_ensure(other, 0);
+  other = vector_shrink(other);
+  other = vector_extend(other, NULL, 0);
+  other = vector_truncate(other, 0);
+  assert(other == vector);
+  assert(malloc_count == 0);
+
+  // Its first growth allocates it, leaving the empty header as it was
+  other = vector_append(other, &(int) { 1 });
+  assert(malloc_count == 1);
+  assert(other != vector);
+  assert_vector_data(other, 1);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 0);
+
+  vector_delete(other);
+  vector_delete(vector);
+
+  // A vector of zero elements from vector_import() or vector_duplicate() also
+  // shares the empty header
+  assert(vector_import((int[]) { 1 }, 0) == vector);
+  assert(vector_duplicate(vector) == vector);
+  assert(malloc_count == 1);
+}
+
+void test_vector_create_with(void) {
+  int *vector;
+
+  // With a volume that causes the vector size to overflow a size_t it returns
+  // NULL with errno = ENOMEM
+  errno = 0;
+  assert(vector_create_with(int, SIZE_MAX / sizeof(int)) == NULL);
+  assert(errno == ENOMEM);
+
   // When the allocation is unsuccessful it returns NULL with errno retained
   // from malloc()
   malloc_errno = ENOENT;
   errno = 0;
-  assert(vector_create() == NULL);
+  assert(vector_create_with(int, 10) == NULL);
   assert(errno == ENOENT);
 
   malloc_errno = 0;
 
-  // When the allocation is successful it returns a new vector with length = 0
-  // and volume = 0
-  int *vector = vector_create();
+  // It returns a new vector with length = 0 and volume = volume
+  vector = vector_create_with(int, 10);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 10);
+
+  // It grows to its volume without a reallocation
+  int *result = vector;
+  for (int i = 0; i < 10; i++)
+    result = vector_append(result, &i);
+  assert(result == vector);
+  assert(vector_volume(vector) == 10);
+
+  vector_delete(vector);
+
+  // With a volume of zero it's vector_create()
+  assert(vector_create_with(int, 0) == vector_create());
+}
+
+void test_vector_create_aligned(void) {
+  size_t *vector;
+
+  // With an alignment that isn't a power of two it returns NULL with errno =
+  // EINVAL
+  errno = 0;
+  assert(vector_create_aligned(0) == NULL);
+  assert(errno == EINVAL);
+  errno = 0;
+  assert(vector_create_aligned(48) == NULL);
+  assert(errno == EINVAL);
+
+  // When the allocation is unsuccessful it returns NULL with errno retained
+  // from malloc()
+  malloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_create_aligned(64) == NULL);
+  assert(errno == ENOENT);
+
+  malloc_errno = 0;
+
+  // With an alignment less than that of a max_align_t it uses that instead
+  vector = vector_create_aligned(1);
+  assert(vector_alignment(vector) == _Alignof(max_align_t));
+  vector_delete(vector);
+
+  // It returns a new vector with its data aligned to the alignment
+  vector = vector_create_aligned(4096);
   assert(vector_length(vector) == 0);
   assert(vector_volume(vector) == 0);
+  assert(vector_alignment(vector) == 4096);
+  assert((uintptr_t) vector % 4096 == 0);
+
+  // Its data remains aligned, with its elements retained, as it's reallocated
+  for (size_t i = 0; i < 4096; i++) {
+    vector = vector_append(vector, &i);
+    assert((uintptr_t) vector % 4096 == 0);
+  }
+  for (size_t i = 0; i < vector_length(vector); i++)
+    assert(vector[i] == i);
+
+  vector = vector_truncate(vector, 4);
+  vector = vector_shrink(vector);
+  assert((uintptr_t) vector % 4096 == 0);
+  assert_vector_data(vector, 0, 1, 2, 3);
+
+  // A duplicate of it has the same alignment
+  size_t *target = vector_duplicate(vector);
+  assert(vector_alignment(target) == 4096);
+  assert((uintptr_t) target % 4096 == 0);
+  assert_vector_data(target, 0, 1, 2, 3);
+
+  vector_delete(target);
+  vector_delete(vector);
+}
+
+static _Bool int_equal(const void *elmt, const void *data) {
+  return *(const int *) elmt == *(const int *) data;
+}
+
+void test_vector_create_local(void) {
+  vector_storage(int, 4) storage;
+  int *vector;
+
+  // It creates a vector in the storage with as many elements as fit in it
+  malloc_count = 0;
+  vector = vector_create_local(&storage, sizeof(storage), sizeof(int));
+  assert((char *) vector > (char *) &storage);
+  assert((char *) vector < (char *) &storage + sizeof(storage));
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 4);
+
+  // It grows within its volume without an allocation
+  vector = vector_extend(vector, ((int[]) { 1, 2, 3, 5 }), 4);
+  assert(malloc_count == 0);
+  assert(vector[0] == 1);
+  assert(*(int *) vector_at(vector, 3, sizeof(int)) == 5);
+  assert(vector_find(vector, int_equal, &(int) { 3 }) == 2);
+
+  // Its removals and resizes within its volume neither allocate nor reduce
+  // its volume
+  vector = vector_remove(vector, 0);
+  vector = vector_shrink(vector);
+  assert(malloc_count == 0);
+  assert(vector_volume(vector) == 4);
+  assert_vector_data(vector, 2, 3, 5);
+  vector = vector_append(vector, &(int) { 8 });
+  assert(malloc_count == 0);
+  assert((char *) vector < (char *) &storage + sizeof(storage));
+  assert_vector_data(vector, 2, 3, 5, 8);
+
+  // It moves to an allocation when it grows beyond its volume
+  vector = vector_append(vector, &(int) { 13 });
+  assert(malloc_count == 1);
+  assert((char *) vector < (char *) &storage
+    || (char *) vector >= (char *) &storage + sizeof(storage));
+  assert_vector_data(vector, 2, 3, 5, 8, 13);
+
+  vector_delete(vector);
+
+  // vector_define_local() creates a vector in automatic storage
+  vector = vector_define_local(int, 16);
+  assert(vector_volume(vector) == 16);
+  for (int i = 0; i < 16; i++)
+    vector = vector_append(vector, &i);
+  assert(malloc_count == 1);
+
+  // It refills its storage after a truncation that the policy would shrink
+  int *local = vector;
+  vector = vector_truncate(vector, 4);
+  assert(vector == local && vector_volume(vector) == 16);
+  for (int i = 4; i < 16; i++)
+    vector = vector_append(vector, &i);
+  assert(vector == local && malloc_count == 1);
+
+  // A duplicate of it is allocated
+  int *target = vector_duplicate(vector);
+  assert(malloc_count == 2);
+  vector_delete(target);
 
   vector_delete(vector);
 }
@@ -88,5 +274,8 @@ void test_vector_import(void) {
 
 int main() {
   test_vector_create();
+  test_vector_create_with();
+  test_vector_create_aligned();
+  test_vector_create_local();
   test_vector_import();
 }
@@ -14,9 +14,20 @@ int main() {
 
   // It deallocates the vector
   vector = vector_create();
+  vector = vector_append(vector, &(int) { 1 });
   vector_delete(vector);
   assert(free_object != NULL);
 
+  // It doesn't deallocate an empty vector that shares the empty header
+  free_object = NULL;
+  vector_delete(vector_create());
+  assert(free_object == NULL);
+
+  // It doesn't deallocate a vector in storage that it doesn't own
+  vector = vector_define_local(int, 4);
+  vector_delete(vector);
+  assert(free_object == NULL);
+
   // It returns NULL
   assert(vector_delete(vector_create()) == NULL);
 
@@ -58,17 +58,19 @@ int main() {
   assert(errno == ENOENT);
 
   // When the volume calculation doesn't overflow, and when a resize to that
-  // volume is successful, it returns the resize result.
+  // volume is successful, it returns the resize result with at least that
+  // volume.
   volume = 40 / 5 * 8 + ((40 % 5) * 8 + 3) / 5;
   vector = vector_ensure(vector, 40);
-  assert(vector_volume(vector) == volume);
+  assert(vector_volume(vector) >= volume);
 
   // When the volume calculation doesn't overflow, and when the resize to that
   // volume is unsuccessful, it returns the result of a resize to the length.
   resize_errno = (int[]) { ENOMEM, 0 };
   vector = vector_ensure(vector, 80);
   resize_errno = NULL;
-  assert(vector_volume(vector) == 80);
+  assert(vector_volume(vector) >= 80);
+  assert(vector_volume(vector) < 80 / 5 * 8);
 
   vector_delete(vector);
 }
@@ -0,0 +1,233 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <vector.h>
+#include "test.h"
+
+static char path[] = "/tmp/test_vector_file.XXXXXX";
+
+// Return the size of the file at path
+static size_t file_size(void) {
+  struct stat status;
+  assert(stat(path, &status) == 0);
+  return (size_t) status.st_size;
+}
+
+void test_vector_file_open(void) {
+  struct vector_file file;
+  size_t *vector;
+
+  // When the file is empty it creates a vector in it
+  vector = vector_file_open(&file, path, size_t);
+  assert(vector != NULL);
+  assert(vector_length(vector) == 0);
+  assert(vector_allocator(vector) == &file.allocator);
+  assert(file_size() == file.mapping);
+
+  // It grows the file with the vector
+  for (size_t i = 0; i < 10000; i++)
+    vector = vector_append(vector, &i);
+  assert(file_size() >= 10000 * sizeof(size_t));
+  assert(file_size() == file.mapping);
+  assert(vector_file_sync(vector) == 0);
+
+  // It leaves the vector in the file on deletion
+  vector_delete(vector);
+  assert(file.fd == -1);
+  assert(file_size() >= 10000 * sizeof(size_t));
+
+  // When the file has a vector it maps that vector
+  struct vector_file other;
+  vector = vector_file_open(&other, path, size_t);
+  assert(vector != NULL);
+  assert(vector_length(vector) == 10000);
+  assert(vector_allocator(vector) == &other.allocator);
+  for (size_t i = 0; i < 10000; i++)
+    assert(vector[i] == i);
+
+  // It shrinks the file with the vector
+  vector = vector_truncate(vector, 10);
+  vector = vector_shrink(vector);
+  assert(vector_length(vector) == 10);
+  assert(file_size() < 10000 * sizeof(size_t));
+  assert_vector_data(vector, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+
+  // It duplicates the vector into an allocation of malloc()
+  size_t *duplicate = vector_duplicate(vector);
+  assert(duplicate != NULL);
+  assert(vector_allocator(duplicate) == NULL);
+  duplicate = vector_append(duplicate, &(size_t) { 10 });
+  assert_vector_data(duplicate, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10);
+  assert(vector_length(vector) == 10);
+  vector_delete(duplicate);
+
+  // It shares the vector as a duplicate that both it and the vector outgrow
+  size_t *share = vector_share(vector);
+  assert(share != NULL && share != vector);
+  assert(vector_allocator(share) == NULL);
+  assert(!vector_shared(vector));
+  for (size_t i = 10; i < 1000; i++)
+    share = vector_append(share, &i);
+  assert(vector_length(share) == 1000 && share[999] == 999);
+  vector = vector_append(vector, &(size_t) { 20 });
+  assert_vector_data(vector, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 20);
+  share = vector_unshare(share);
+  assert(vector_length(share) == 1000);
+  vector_delete(share);
+  vector = vector_truncate(vector, 10);
+
+  vector_delete(vector);
+  vector = vector_file_open(&file, path, size_t);
+  assert_vector_data(vector, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9);
+  vector_delete(vector);
+}
+
+void test_vector_file_invalid(void) {
+  struct vector_file file;
+  FILE *stream;
+
+  // When the vector in the file has another element size it fails
+  errno = 0;
+  assert(vector_file_open(&file, path, char) == NULL);
+  assert(errno == EINVAL);
+  assert(file.fd == -1);
+
+  // When the file isn't a file of a vector it fails
+  assert((stream = fopen(path, "w")) != NULL);
+  for (int i = 0; i < 4096; i++)
+    fputc('x', stream);
+  fclose(stream);
+  errno = 0;
+  assert(vector_file_open(&file, path, size_t) == NULL);
+  assert(errno == EINVAL);
+
+  // When the file is too short to be a file of a vector it fails
+  assert(truncate(path, 8) == 0);
+  errno = 0;
+  assert(vector_file_open(&file, path, size_t) == NULL);
+  assert(errno == EINVAL);
+}
+
+void test_vector_file_shift(void) {
+  struct vector_file file;
+  struct pair { uint64_t first, second; } *vector;
+
+  assert(truncate(path, 0) == 0);
+
+  // It keeps the header of a new vector at the start of the file, where a
+  // reopen reads it, as the vector grows and shifts
+  vector = vector_file_open(&file, path, struct pair);
+  assert(vector != NULL);
+  for (uint64_t i = 0; i < 200; i++)
+    vector = vector_append(vector, &(struct pair) { i, i * 2 });
+  vector = vector_shift(vector, NULL);
+  assert(vector_length(vector) == 199);
+  assert(vector_file_sync(vector) == 0);
+  vector_delete(vector);
+
+  vector = vector_file_open(&file, path, struct pair);
+  assert(vector != NULL);
+  assert(vector_length(vector) == 199);
+  for (uint64_t i = 0; i < 199; i++)
+    assert(vector[i].first == i + 1 && vector[i].second == (i + 1) * 2);
+
+  // It keeps the volume of a vector that was set to keep it across a reopen
+  assert(vector_policy_keep(vector, 1) == vector);
+  size_t volume = vector_volume(vector);
+  assert(vector_file_sync(vector) == 0);
+  vector_delete(vector);
+  vector = vector_file_open(&file, path, struct pair);
+  assert(vector != NULL);
+  vector = vector_truncate(vector, 0);
+  assert(vector_volume(vector) == volume);
+  vector_delete(vector);
+}
+
+void test_vector_file_shared(void) {
+  struct vector_file builder, reader;
+  int fd = memfd_create("test_vector_file", MFD_CLOEXEC);
+  int *vector;
+
+  // It builds a vector in a shared memory object
+  vector = vector_file_open_fd(&builder, fd, int);
+  assert(vector != NULL);
+  assert(builder.fd != fd);
+  for (int i = 0; i < 10000; i++)
+    vector = vector_append(vector, &i);
+
+  // When the file is empty it doesn't attach to it
+  int empty = memfd_create("test_vector_file_empty", MFD_CLOEXEC);
+  errno = 0;
+  assert(vector_file_attach(&reader, empty, int) == NULL);
+  assert(errno == EINVAL);
+  close(empty);
+
+  // It attaches to the vector in another process without copying it
+  pid_t pid = fork();
+  assert(pid >= 0);
+  if (pid == 0) {
+    const int *attached = vector_file_attach(&reader, fd, int);
+    if (attached == NULL || vector_length(attached) != 10000)
+      _exit(1);
+    for (int i = 0; i < 10000; i++)
+      if (attached[i] != i)
+        _exit(1);
+    vector_file_detach(attached);
+    _exit(0);
+  }
+  int status;
+  assert(waitpid(pid, &status, 0) == pid);
+  assert(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+  // It attaches to the vector read-only
+  const int *attached = vector_file_attach(&reader, fd, int);
+  assert(attached != NULL);
+  assert(vector_allocator(attached) == &reader.allocator);
+  assert(vector_length(attached) == 10000);
+  assert(attached[9999] == 9999);
+  errno = 0;
+  assert(vector_resize((int *) attached, 20000) == NULL);
+  assert(errno == EPERM);
+
+  // It duplicates the attached vector into a private copy
+  int *copy = vector_duplicate(attached);
+  assert(copy != NULL);
+  assert(vector_allocator(copy) == NULL);
+  copy[0] = -1;
+  copy = vector_append(copy, &(int) { 10000 });
+  assert(vector_length(copy) == 10001 && copy[9999] == 9999);
+  assert(attached[0] == 0);
+  vector_delete(copy);
+
+  // It leaves the vector of the builder as is
+  assert(vector_allocator(vector) == &builder.allocator);
+  vector = vector_append(vector, &(int) { 10000 });
+  assert(vector_length(vector) == 10001);
+  assert(vector_length(attached) == 10000);
+
+  assert(vector_file_detach(attached) == NULL);
+  assert(reader.fd == -1);
+  vector_delete(vector);
+  close(fd);
+}
+
+int main() {
+  int fd = mkstemp(path);
+  assert(fd >= 0);
+  close(fd);
+
+  test_vector_file_open();
+  test_vector_file_invalid();
+  test_vector_file_shift();
+  test_vector_file_shared();
+
+  unlink(path);
+}
@@ -0,0 +1,124 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int realloc_errno = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  if (realloc_errno != 0)
+    return errno = realloc_errno, NULL;
+  return realloc(data, size);
+}
+
+// Return the element at index i in the vector of the gap
+static int at(const struct vector_gap *gap, size_t i) {
+  return *(int *) vector_gap_at(gap, i);
+}
+
+void test_vector_gap_inject(void) {
+  int *vector = vector_define(int, 1, 2, 3, 4);
+  struct vector_gap gap;
+
+  assert(vector_gap_begin(&gap, vector) == 0);
+  assert(vector_gap_length(&gap) == 4);
+
+  // It inserts elements at a moving cursor
+  for (int i = 0; i < 100; i++)
+    assert(vector_gap_insert(&gap, 2 + (size_t) i, &(int) { 10 + i }) == 0);
+  assert(vector_gap_length(&gap) == 104);
+  assert(at(&gap, 0) == 1 && at(&gap, 1) == 2);
+  for (int i = 0; i < 100; i++)
+    assert(at(&gap, 2 + (size_t) i) == 10 + i);
+  assert(at(&gap, 102) == 3 && at(&gap, 103) == 4);
+
+  // It moves the gap back toward the head
+  int data[] = { 7, 8 };
+  assert(vector_gap_inject(&gap, 1, data, 2) == 0);
+  assert(gap.index == 3);
+  assert(at(&gap, 0) == 1 && at(&gap, 1) == 7 && at(&gap, 2) == 8);
+  assert(at(&gap, 3) == 2 && at(&gap, 105) == 4);
+
+  // It materializes the vector with its elements contiguous
+  vector = vector_gap_materialize(&gap);
+  assert(vector_length(vector) == 106);
+  assert(vector[0] == 1 && vector[1] == 7 && vector[2] == 8 && vector[3] == 2);
+  for (int i = 0; i < 100; i++)
+    assert(vector[4 + i] == 10 + i);
+  assert(vector[104] == 3 && vector[105] == 4);
+
+  // It reopens the gap on a subsequent edit
+  assert(vector_gap_insert(&gap, 0, &(int) { 0 }) == 0);
+  vector = vector_gap_materialize(&gap);
+  assert(vector_length(vector) == 107);
+  assert(vector[0] == 0 && vector[1] == 1 && vector[106] == 4);
+
+  vector_delete(vector);
+}
+
+void test_vector_gap_excise(void) {
+  int *vector = vector_define(int, 1, 2, 3, 4, 5, 6, 7, 8);
+  struct vector_gap gap;
+
+  assert(vector_gap_begin(&gap, vector) == 0);
+
+  // It removes the elements after the gap
+  vector_gap_excise(&gap, 6, 1);
+  vector_gap_excise(&gap, 2, 2);
+  assert(vector_gap_length(&gap) == 5);
+  assert(at(&gap, 1) == 2 && at(&gap, 2) == 5 && at(&gap, 4) == 8);
+
+  // It fills the gap that a removal leaves without a reallocation
+  realloc_errno = ENOENT;
+  int data[] = { 9, 9, 9 };
+  assert(vector_gap_inject(&gap, 2, data, 3) == 0);
+  realloc_errno = 0;
+
+  vector = vector_gap_materialize(&gap);
+  assert_vector_data(vector, 1, 2, 9, 9, 9, 5, 6, 8);
+  vector_delete(vector);
+}
+
+void test_vector_gap_fail(void) {
+  int *vector = vector_define(int, 1);
+  struct vector_gap gap;
+
+  vector = vector_shrink(vector);
+  assert(vector_gap_begin(&gap, vector) == 0);
+
+  // When the growth fails it returns -1 with errno retained from realloc()
+  realloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_gap_insert(&gap, 0, &(int) { 2 }) == -1);
+  assert(errno == ENOENT);
+  realloc_errno = 0;
+  assert(vector_gap_length(&gap) == 1);
+
+  // With a length that overflows a size_t it returns -1 with errno = ENOMEM
+  errno = 0;
+  assert(vector_gap_inject(&gap, 0, NULL, SIZE_MAX) == -1);
+  assert(errno == ENOMEM);
+  vector_delete(vector_gap_materialize(&gap));
+
+  // It begins a vector that's shared by unsharing it
+  vector = vector_define(int, 1, 2);
+  int *share = vector_share(vector);
+  assert(vector_gap_begin(&gap, share) == 0);
+  assert(gap.vector != vector);
+  assert(vector_gap_insert(&gap, 0, &(int) { 0 }) == 0);
+  share = vector_gap_materialize(&gap);
+  assert_vector_data(share, 0, 1, 2);
+  assert_vector_data(vector, 1, 2);
+
+  vector_delete(share);
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_gap_inject();
+  test_vector_gap_excise();
+  test_vector_gap_fail();
+}
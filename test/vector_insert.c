@@ -150,6 +150,87 @@ void test_vector_inject(void) {
   vector_delete(vector);
 }
 
+void test_vector_inject_zeroed(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5);
+  int *result;
+
+  // It injects zeroed elements into the vector at the index
+  vector = vector_inject_zeroed(vector, 2, 2);
+  assert_vector_data(vector, 1, 2, 0, 0, 3, 5);
+
+  // It zeroes elements appended within the volume of the vector
+  vector = vector_truncate(vector, 5);
+  vector[4] = 8;
+  vector = vector_truncate(vector, 4);
+  vector = vector_inject_zeroed(vector, vector_length(vector), 1);
+  assert_vector_data(vector, 1, 2, 0, 0, 0);
+
+  // It appends zeroed elements beyond the volume of the vector
+  vector = vector_inject_zeroed(vector, vector_length(vector), 1000);
+  assert(vector_length(vector) == 1005);
+  for (size_t i = 2; i < 1005; i++)
+    assert(vector[i] == 0);
+
+  // With a length that, when added to the vector's length, overflows a size_t;
+  // it returns NULL with errno = ENOMEM. The vector is unmodified.
+  errno = 0;
+  result = vector_inject_zeroed(vector, 0, SIZE_MAX);
+  assert(result == NULL);
+  assert(errno == ENOMEM);
+  assert(vector_length(vector) == 1005);
+
+  vector_delete(vector);
+}
+
+void test_vector_inject_many(void) {
+  int *vector = vector_define(int, 1, 3, 5);
+  int *result;
+
+  // It inserts each element before the element at its index
+  vector = vector_inject_many(vector, ((size_t[]) { 0, 1, 2, 3 }),
+      &(int[]) { 0, 2, 4, 6 }, 4);
+  assert_vector_data(vector, 0, 1, 2, 3, 4, 5, 6);
+
+  // It inserts the elements with the same index in their order
+  vector = vector_inject_many(vector, ((size_t[]) { 1, 1, 7, 7 }),
+      &(int[]) { 7, 8, 9, 10 }, 4);
+  assert_vector_data(vector, 0, 7, 8, 1, 2, 3, 4, 5, 6, 9, 10);
+
+  // It inserts uninitialized elements when elmt is NULL
+  vector = vector_inject_many(vector, ((size_t[]) { 0, 11 }), NULL, 2);
+  assert(vector_length(vector) == 13);
+  vector[0] = -1;
+  vector[12] = 11;
+  assert_vector_data(vector, -1, 0, 7, 8, 1, 2, 3, 4, 5, 6, 9, 10, 11);
+
+  // It grows the vector once for many elements
+  size_t positions[1000];
+  int data[1000];
+  for (size_t i = 0; i < 1000; i++) {
+    positions[i] = i * 13 / 1000;
+    data[i] = -(int) i;
+  }
+  vector = vector_inject_many(vector, positions, data, 1000);
+  assert(vector_length(vector) == 1013);
+  int before[] = { -1, 0, 7, 8, 1, 2, 3, 4, 5, 6, 9, 10, 11 };
+  for (size_t i = 0, j = 0; i < 1013; i++) {
+    if (j < 1000 && positions[j] + j == i)
+      assert(vector[i] == data[j++]);
+    else
+      assert(vector[i] == before[i - j]);
+  }
+
+  // With a count that, when added to the vector's length, overflows a size_t;
+  // it returns NULL with errno = ENOMEM. The vector is unmodified.
+  errno = 0;
+  result = vector_inject_many(vector, positions, NULL, SIZE_MAX);
+  assert(result == NULL);
+  assert(errno == ENOMEM);
+  assert(vector_length(vector) == 1013);
+
+  vector_delete(vector);
+}
+
 void test_vector_append(void) {
   int *vector = vector_define(int, 1, 2, 3, 5, 8, 13);
   int data = 13;
@@ -215,9 +296,51 @@ void test_vector_extend(void) {
   vector_delete(result);
 }
 
+void test_vector_emplace_back(void) {
+  struct record { int id; char name[200]; } *vector = vector_create();
+  struct record *record;
+  int number = 0;
+
+  // It evaluates each argument once
+  record = vector_emplace_back((number++, &vector), 1);
+  assert(number == 1);
+  record = vector_emplace_back(&vector, (number++, 1));
+  assert(number == 2);
+
+  // It returns a pointer to the appended elements of the type of the vector
+  // and stores the resultant vector
+  record = vector_emplace_back(&vector, 2);
+  assert(vector_length(vector) == 4);
+  assert(record == &vector[2]);
+  record[0].id = 3;
+  record[1].id = 4;
+  assert(vector[2].id == 3 && vector[3].id == 4);
+
+  // When the growth fails it returns NULL with the vector unmodified
+  struct record *original = vector = vector_shrink(vector);
+  ensure_errno = ENOENT;
+  errno = 0;
+  assert(vector_emplace_back(&vector, 1) == NULL);
+  assert(errno == ENOENT);
+  ensure_errno = 0;
+  assert(vector == original);
+  assert(vector_length(vector) == 4 && vector[3].id == 4);
+
+  // With a length that overflows a size_t it returns NULL with errno = ENOMEM
+  errno = 0;
+  assert(vector_emplace_back_z((vector_t *) &vector, SIZE_MAX, 1) == NULL);
+  assert(errno == ENOMEM);
+  assert(vector == original);
+
+  vector_delete(vector);
+}
+
 int main() {
   test_vector_insert();
   test_vector_inject();
+  test_vector_inject_zeroed();
+  test_vector_inject_many();
   test_vector_append();
   test_vector_extend();
+  test_vector_emplace_back();
 }
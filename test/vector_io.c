@@ -0,0 +1,146 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <vector.h>
+#include "test.h"
+
+// Return the descriptor of an empty temporary file
+static int temporary(void) {
+  FILE *stream = tmpfile();
+  assert(stream != NULL);
+  return dup(fileno(stream));
+}
+
+void test_vector_write_fd(void) {
+  int fd = temporary();
+  int *vector = vector_define(int, 1, 2, 3, 4, 5);
+  struct __vector_io_header_t header;
+
+  // It writes the header and then the data
+  assert(vector_write_fd(vector, fd) == 0);
+  assert((size_t) lseek(fd, 0, SEEK_CUR) == sizeof(header) + 5 * sizeof(int));
+
+  assert(pread(fd, &header, sizeof(header), 0) == sizeof(header));
+  assert(!memcmp(header.magic, __VECTOR_IO_MAGIC, 8));
+  assert(header.version == 1);
+  assert(header.order == 0x01020304);
+  assert(header.z == sizeof(int));
+  assert(header.length == 5);
+  assert(header.checksum == __vector_io_checksum(vector, 5 * sizeof(int)));
+
+  int data[5];
+  assert(pread(fd, data, sizeof(data), sizeof(header)) == sizeof(data));
+  assert(!memcmp(data, vector, sizeof(data)));
+
+  vector_delete(vector);
+  close(fd);
+}
+
+void test_vector_read_fd(void) {
+  int fd = temporary();
+  size_t *vector = vector_create();
+
+  for (size_t i = 0; i < 100000; i++)
+    vector = vector_append(vector, &i);
+  size_t *empty = vector_create();
+  assert(vector_write_fd(vector, fd) == 0);
+  assert(vector_write_fd(empty, fd) == 0);
+  lseek(fd, 0, SEEK_SET);
+
+  // It reads a vector of exactly the length that was written
+  size_t *read = vector_read_fd(size_t, fd);
+  assert(read != NULL);
+  assert(vector_length(read) == 100000);
+  assert(vector_volume(read) == 100000);
+  assert(!memcmp(read, vector, 100000 * sizeof(size_t)));
+  vector_delete(read);
+
+  // It reads an empty vector
+  read = vector_read_fd(size_t, fd);
+  assert(read != NULL);
+  assert(vector_length(read) == 0);
+  vector_delete(read);
+
+  // When the descriptor ends before a header it fails
+  errno = 0;
+  assert(vector_read_fd(size_t, fd) == NULL);
+  assert(errno == EBADMSG);
+
+  // When the element size doesn't match it fails
+  lseek(fd, 0, SEEK_SET);
+  errno = 0;
+  assert(vector_read_fd(int, fd) == NULL);
+  assert(errno == EINVAL);
+
+  vector_delete(empty);
+  vector_delete(vector);
+  close(fd);
+}
+
+void test_vector_read_fd_corrupt(void) {
+  int fd = temporary();
+  int *vector = vector_define(int, 1, 2, 3, 4, 5);
+  struct __vector_io_header_t header;
+
+  assert(vector_write_fd(vector, fd) == 0);
+
+  // When the data doesn't match its checksum it fails
+  assert(pwrite(fd, &(int) { 6 }, sizeof(int), sizeof(header)) == sizeof(int));
+  lseek(fd, 0, SEEK_SET);
+  errno = 0;
+  assert(vector_read_fd(int, fd) == NULL);
+  assert(errno == EBADMSG);
+
+  // When the descriptor ends before the data it fails
+  assert(ftruncate(fd, sizeof(header) + 2 * sizeof(int)) == 0);
+  lseek(fd, 0, SEEK_SET);
+  errno = 0;
+  assert(vector_read_fd(int, fd) == NULL);
+  assert(errno == EBADMSG);
+
+  // When the header isn't a header of a vector it fails
+  assert(pwrite(fd, "VECTOR", 6, 0) == 6);
+  lseek(fd, 0, SEEK_SET);
+  errno = 0;
+  assert(vector_read_fd(int, fd) == NULL);
+  assert(errno == EINVAL);
+
+  // When the header is in another byte order it fails
+  lseek(fd, 0, SEEK_SET);
+  assert(vector_write_fd(vector, fd) == 0);
+  assert(pread(fd, &header, sizeof(header), 0) == sizeof(header));
+  header.order = __builtin_bswap32(header.order);
+  assert(pwrite(fd, &header, sizeof(header), 0) == sizeof(header));
+  lseek(fd, 0, SEEK_SET);
+  errno = 0;
+  assert(vector_read_fd(int, fd) == NULL);
+  assert(errno == EINVAL);
+
+  vector_delete(vector);
+  close(fd);
+}
+
+void test_vector_io_checksum(void) {
+  char data[100] = { 0 };
+
+  // It depends on each byte and on the size
+  uint64_t checksum = __vector_io_checksum(data, sizeof(data));
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = 1;
+    assert(__vector_io_checksum(data, sizeof(data)) != checksum);
+    data[i] = 0;
+  }
+  assert(__vector_io_checksum(data, sizeof(data) - 1) != checksum);
+}
+
+int main() {
+  test_vector_write_fd();
+  test_vector_read_fd();
+  test_vector_read_fd_corrupt();
+  test_vector_io_checksum();
+}
@@ -0,0 +1,185 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include <vector.h>
+#include "test.h"
+
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  malloc_count++;
+  return malloc(size);
+}
+
+static size_t realloc_count = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  realloc_count++;
+  return realloc(data, size);
+}
+
+static size_t free_count = 0;
+__attribute__((used)) void stub_free(void *data) {
+  free_count++;
+  free(data);
+}
+
+// Return whether the vector is at the expected offset into a page
+static _Bool is_mapped(vector_c vector) {
+  size_t page = (size_t) sysconf(_SC_PAGESIZE);
+  size_t offset = offsetof(struct __vector_map_object_t, data)
+    + offsetof(struct __vector_header_t, data);
+  return (uintptr_t) vector % page == offset;
+}
+
+void test_vector_map_init(void) {
+  struct vector_map map;
+
+  // It returns the allocator of the map with the threshold set
+  assert(vector_map_init(&map, 4096) == &map.allocator);
+  assert(map.allocator.data == &map);
+  assert(map.threshold == 4096);
+}
+
+void test_vector_map_allocate(void) {
+  size_t page = (size_t) sysconf(_SC_PAGESIZE);
+  struct vector_map map;
+  size_t *vector;
+
+  vector_map_init(&map, page);
+
+  // When the vector is smaller than the threshold it's allocated by malloc()
+  malloc_count = 0;
+  vector = vector_create_in(&map.allocator);
+  assert(malloc_count == 1);
+  assert(vector_allocator(vector) == &map.allocator);
+
+  for (size_t i = 0; i < 16; i++)
+    vector = vector_append(vector, &i);
+  assert(!is_mapped(vector));
+
+  // When the vector grows across the threshold it's moved to a mapping
+  malloc_count = 0;
+  realloc_count = 0;
+  for (size_t i = 16; i < page; i++)
+    vector = vector_append(vector, &i);
+  assert(is_mapped(vector));
+
+  // When the vector grows beyond the threshold it's remapped
+  vector = vector_resize(vector, page * 64);
+  assert(is_mapped(vector));
+  assert(malloc_count == 0);
+  assert(realloc_count < 16);
+  assert(vector_length(vector) == page);
+  for (size_t i = 0; i < vector_length(vector); i++)
+    assert(vector[i] == i);
+
+  // When the vector shrinks below the threshold it's moved to malloc()
+  malloc_count = 0;
+  vector = vector_truncate(vector, 8);
+  vector = vector_shrink(vector);
+  assert(!is_mapped(vector));
+  assert(malloc_count == 1);
+  assert_vector_data(vector, 0, 1, 2, 3, 4, 5, 6, 7);
+
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 1);
+
+  // A mapped vector is deallocated without free()
+  vector = vector_create_in(&map.allocator);
+  vector = vector_resize(vector, page);
+  assert(is_mapped(vector));
+  free_count = 0;
+  vector_delete(vector);
+  assert(free_count == 0);
+}
+
+void test_vector_map_init_huge(void) {
+  struct vector_map map;
+
+  // It returns the allocator of the map with the threshold and huge set
+  assert(vector_map_init_huge(&map, 4096) == &map.allocator);
+  assert(map.allocator.data == &map);
+  assert(map.threshold == 4096);
+  assert(map.huge);
+
+  // vector_map_init() doesn't set huge
+  vector_map_init(&map, 4096);
+  assert(!map.huge);
+}
+
+void test_vector_map_huge(void) {
+  size_t page = (size_t) sysconf(_SC_PAGESIZE);
+  const size_t huge = (size_t) 2 << 20;
+  struct vector_map map;
+  size_t *vector;
+
+  vector_map_init_huge(&map, page);
+
+  // When the vector is smaller than the threshold it's allocated by malloc()
+  malloc_count = 0;
+  vector = vector_create_in(&map.allocator);
+  assert(malloc_count == 1);
+
+  // When the vector is in a mapping its data is aligned to a huge page
+  vector = vector_resize(vector, page);
+  assert((uintptr_t) vector % huge == 0);
+
+  for (size_t i = 0; i < page; i++)
+    vector = vector_append(vector, &i);
+
+  // Its data is still aligned to a huge page as it's reallocated
+  for (size_t volume = huge; volume <= huge * 4; volume += huge / 2) {
+    // another mapping in the way of its growth
+    size_t *block = vector_create_in(&map.allocator);
+    block = vector_resize(block, page);
+
+    vector = vector_resize(vector, volume);
+    assert((uintptr_t) vector % huge == 0);
+    assert(vector_length(vector) == page);
+    for (size_t i = 0; i < vector_length(vector); i++)
+      assert(vector[i] == i);
+
+    vector_delete(block);
+  }
+
+  // When the vector shrinks its data is still aligned to a huge page
+  vector = vector_resize(vector, huge / sizeof(size_t) + 1);
+  assert((uintptr_t) vector % huge == 0);
+  assert(vector_length(vector) == page);
+  for (size_t i = 0; i < vector_length(vector); i++)
+    assert(vector[i] == i);
+
+  // When the vector shrinks below the threshold it's moved to malloc()
+  vector = vector_resize(vector, 8);
+  assert_vector_data(vector, 0, 1, 2, 3, 4, 5, 6, 7);
+
+  vector_delete(vector);
+}
+
+void test_vector_map_overflow(void) {
+  struct vector_map map;
+  char *vector;
+
+  vector_map_init(&map, 0);
+  vector = vector_create_in(&map.allocator);
+
+  // With a size that overflows when rounded to a page it returns NULL with
+  // errno = ENOMEM
+  errno = 0;
+  assert(vector_resize(vector, SIZE_MAX - 64) == NULL);
+  assert(errno == ENOMEM);
+
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_map_init();
+  test_vector_map_allocate();
+  test_vector_map_init_huge();
+  test_vector_map_huge();
+  test_vector_map_overflow();
+}
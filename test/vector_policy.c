@@ -0,0 +1,195 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int malloc_errno = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  if (malloc_errno != 0)
+    return errno = malloc_errno, NULL;
+  return malloc(size);
+}
+
+static const struct vector_policy doubling = {
+  .growth_numerator = 2,
+  .growth_denominator = 1,
+  .shrink_divisor = 4,
+  .shrink_numerator = 2,
+  .shrink_denominator = 1,
+};
+
+// An allocator without a usable function so that each volume is exact
+static void *exact_allocate(size_t size, void *data) {
+  (void) data;
+  return malloc(size);
+}
+
+static void *exact_reallocate(void *object, size_t size, void *data) {
+  (void) data;
+  return realloc(object, size);
+}
+
+static void exact_deallocate(void *object, void *data) {
+  (void) data;
+  free(object);
+}
+
+static const struct vector_allocator exact = {
+  .allocate = exact_allocate,
+  .reallocate = exact_reallocate,
+  .deallocate = exact_deallocate,
+};
+
+void test_vector_policy_set(void) {
+  // The calling thread initially has the default policy
+  assert(vector_policy() == NULL);
+
+  // It sets the policy and returns the previous policy
+  assert(vector_policy_set(&doubling) == NULL);
+  assert(vector_policy() == &doubling);
+  assert(vector_policy_set(NULL) == &doubling);
+  assert(vector_policy() == NULL);
+}
+
+void test_vector_policy_grow(void) {
+  int *vector = vector_create_in(&exact);
+
+  // With the default policy it grows by a factor of 8/5
+  vector = vector_ensure(vector, 10);
+  assert(vector_volume(vector) == 16);
+
+  // With a policy it grows by the factor of the policy
+  vector_policy_set(&doubling);
+  vector = vector_ensure(vector, 20);
+  assert(vector_volume(vector) == 40);
+
+  // With a step it grows by at least the step
+  struct vector_policy step = doubling;
+  step.step = 100 * sizeof(int);
+  vector_policy_set(&step);
+  vector = vector_ensure(vector, 41);
+  assert(vector_volume(vector) == 141);
+
+  // With a rounding the size of the vector is a multiple of it
+  struct vector_policy round = doubling;
+  round.round = 4096;
+  vector_policy_set(&round);
+  vector = vector_ensure(vector, 1000);
+  size_t size = sizeof(struct __vector_header_t)
+    + vector_volume(vector) * sizeof(int);
+  assert(vector_volume(vector) >= 2000);
+  assert(size % 4096 == 0);
+
+  // With a factor that overflows it resizes to just the length
+  struct vector_policy huge = doubling;
+  huge.growth_numerator = SIZE_MAX;
+  vector_policy_set(&huge);
+  vector = vector_ensure(vector, 10000);
+  assert(vector_volume(vector) == 10000);
+
+  // With a size that overflows it grows to just the length, with or without a
+  // rounding
+  huge.growth_numerator = SIZE_MAX / 10000 / 2;
+  assert(__vector_policy_grow(10000, sizeof(int)) == 10000);
+  huge.round = 4096;
+  assert(__vector_policy_grow(10000, sizeof(int)) == 10000);
+  huge.round = 0;
+  assert(__vector_policy_grow(10000, 1) > 10000);
+
+  vector_policy_set(NULL);
+  vector_delete(vector);
+}
+
+void test_vector_policy_shrink(void) {
+  int *vector = vector_create_in(&exact);
+
+  vector_policy_set(&doubling);
+  vector = vector_resize(vector, 100);
+  for (int i = 0; i < 100; i++)
+    vector = vector_append(vector, &i);
+
+  // When the length isn't below the volume over the divisor it doesn't shrink
+  vector = vector_truncate(vector, 25);
+  assert(vector_volume(vector) == 100);
+
+  // When the length is below the volume over the divisor it shrinks by the
+  // factor of the policy
+  vector = vector_truncate(vector, 24);
+  assert(vector_volume(vector) == 48);
+  assert(vector_length(vector) == 24);
+  for (int i = 0; i < 24; i++)
+    assert(vector[i] == i);
+
+  // With a divisor of zero it never shrinks
+  struct vector_policy never = doubling;
+  never.shrink_divisor = 0;
+  vector_policy_set(&never);
+  vector = vector_truncate(vector, 0);
+  assert(vector_volume(vector) == 48);
+
+  vector_policy_set(NULL);
+  vector_delete(vector);
+}
+
+void test_vector_policy_keep(void) {
+  int *vector = vector_create_with(int, 100);
+
+  // It replaces the empty vector, which is read-only, with an allocation
+  int *empty = vector_create();
+  assert(vector_policy_keep(empty, 0) == empty);
+  malloc_errno = ENOMEM;
+  errno = 0;
+  assert(vector_policy_keep(empty, 1) == NULL);
+  assert(errno == ENOMEM);
+  malloc_errno = 0;
+  int *keep = vector_policy_keep(empty, 1);
+  assert(keep != NULL && keep != empty);
+  assert(vector_length(keep) == 0 && vector_volume(keep) == 0);
+  for (int i = 0; i < 100; i++)
+    keep = vector_append(keep, &i);
+  size_t volume = vector_volume(keep);
+  keep = vector_truncate(keep, 0);
+  assert(vector_volume(keep) == volume);
+  vector_delete(keep);
+
+  // When it's set a removal doesn't shrink the vector
+  assert(vector_policy_keep(vector, 1) == vector);
+  for (int i = 0; i < 100; i++)
+    vector = vector_append(vector, &i);
+  vector = vector_truncate(vector, 0);
+  assert(vector_volume(vector) == 100);
+  for (int i = 0; i < 10; i++)
+    vector = vector_append(vector, &i);
+  vector = vector_remove(vector, 0);
+  vector = vector_shift(vector, NULL);
+  assert(vector_length(vector) == 8);
+  assert(vector_volume(vector) >= 98);
+
+  // It's retained as the vector is reallocated and unshared
+  vector = vector_resize(vector, 1000);
+  int *share = vector_share(vector);
+  share = vector_truncate(share, 0);
+  assert(vector_volume(share) == 1000);
+  vector_delete(share);
+  vector = vector_excise(vector, 0, 8);
+  assert(vector_volume(vector) == 1000);
+
+  // When it's unset a removal shrinks the vector again
+  assert(vector_policy_keep(vector, 0) == vector);
+  vector = vector_append(vector, &(int) { 1 });
+  vector = vector_truncate(vector, 0);
+  assert(vector_volume(vector) < 1000);
+
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_policy_set();
+  test_vector_policy_grow();
+  test_vector_policy_shrink();
+  test_vector_policy_keep();
+}
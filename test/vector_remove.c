@@ -141,8 +141,180 @@ void test_vector_truncate(void) {
   vector_delete(result);
 }
 
+// vector_truncate_keep(), vector_truncate_keep_z()
+
+void test_vector_truncate_keep(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+  size_t volume = vector_volume(vector);
+
+  // It reduces the length without a reallocation
+  int *result = vector_truncate_keep(vector, 1);
+  assert(result == vector);
+  assert_vector_data(result, 1);
+  assert(vector_volume(result) == volume);
+
+  // It unshares the vector and leaves the other reference as is
+  vector = vector_extend(result, &(int[]) { 2, 3 }, 2);
+  int *share = vector_share(vector);
+  share = vector_truncate_keep(share, 0);
+  assert(share != vector);
+  assert(vector_length(share) == 0);
+  assert_vector_data(vector, 1, 2, 3);
+
+  vector_delete(share);
+  vector_delete(vector);
+}
+
+// vector_clear(), vector_clear_z()
+
+void test_vector_clear(void) {
+  int *vector = vector_create();
+
+  // It leaves the empty vector as is
+  assert(vector_clear(vector) == vector);
+
+  // It removes each element without a reallocation
+  for (int i = 0; i < 100; i++)
+    vector = vector_append(vector, &i);
+  size_t volume = vector_volume(vector);
+  int *result = vector_clear(vector);
+  assert(result == vector);
+  assert(vector_length(result) == 0);
+  assert(vector_volume(result) == volume);
+
+  vector_delete(result);
+}
+
+// vector_remove_if(), vector_remove_if_z()
+
+static _Bool odd(const void *elmt, void *data) {
+  ++*(size_t *) data;
+  return *(const int *) elmt % 2 != 0;
+}
+
+void test_vector_remove_if(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+  size_t calls = 0;
+
+  // It removes each element that the predicate is true of, in one pass
+  vector = vector_remove_if(vector, odd, &calls);
+  assert_vector_data(vector, 2, 8, 34);
+  assert(calls == 10);
+
+  // When the predicate is true of no element it leaves the vector as is
+  vector = vector_remove_if(vector, odd, &calls);
+  assert_vector_data(vector, 2, 8, 34);
+
+  // It reduces the volume of the vector once for the resultant length
+  vector = vector_ensure(vector, 100);
+  for (int i = 0; i < 97; i++)
+    vector = vector_append(vector, &(int) { 2 * i + 1 });
+  vector = vector_remove_if(vector, odd, &calls);
+  assert_vector_data(vector, 2, 8, 34);
+  assert(vector_volume(vector) < 10);
+
+  vector_delete(vector);
+}
+
+// vector_remove_indices(), vector_remove_indices_z()
+
+void test_vector_remove_indices(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+
+  // It removes the elements at the indices
+  vector = vector_remove_indices(vector, ((size_t[]) { 0, 2, 3, 9 }), 4);
+  assert_vector_data(vector, 2, 8, 13, 21, 34, 55);
+
+  // With no indices it leaves the vector as is
+  vector = vector_remove_indices(vector, ((size_t[]) { 0 }), 0);
+  assert_vector_data(vector, 2, 8, 13, 21, 34, 55);
+
+  // It removes each element of the vector
+  vector = vector_remove_indices(vector, ((size_t[]) { 0, 1, 2, 3, 4, 5 }), 6);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 0);
+
+  vector_delete(vector);
+}
+
+// vector_remove_bitmap(), vector_remove_bitmap_z()
+
+void test_vector_remove_bitmap(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+
+  // It removes the elements with their bit set
+  vector = vector_remove_bitmap(vector, ((unsigned char[]) { 0x0d, 0x02 }));
+  assert_vector_data(vector, 2, 8, 13, 21, 34, 55);
+
+  vector_delete(vector);
+}
+
+// vector_remove_unordered(), vector_remove_unordered_z()
+
+void test_vector_remove_unordered(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8);
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_remove_unordered((number++, vector), 0);
+  assert(number == 1);
+  vector = vector_remove_unordered(vector, (number++, 0));
+  assert(number == 2);
+  assert_vector_data(vector, 5, 2, 3);
+
+  vector_delete(vector);
+  vector = vector_define(int, 1, 2, 3, 5, 8);
+
+  // It moves the last element to the index of the removed element
+  vector = vector_remove_unordered(vector, 1);
+  assert_vector_data(vector, 1, 8, 3, 5);
+
+  // It removes the last element
+  vector = vector_remove_unordered(vector, 3);
+  assert_vector_data(vector, 1, 8, 3);
+
+  vector_delete(vector);
+}
+
+// vector_excise_unordered(), vector_excise_unordered_z()
+
+void test_vector_excise_unordered(void) {
+  int *vector = vector_define(int, 1, 2, 3, 5, 8, 13, 21, 34, 55, 89);
+
+  // It moves the last elements to the indices of the removed elements
+  vector = vector_excise_unordered(vector, 1, 3);
+  assert_vector_data(vector, 1, 34, 55, 89, 8, 13, 21);
+
+  // It moves just the elements after the removed elements
+  vector = vector_excise_unordered(vector, 3, 3);
+  assert_vector_data(vector, 1, 34, 55, 21);
+
+  // When the resultant length of the vector is less than the overallocation
+  // threshold it reduces the volume of the vector
+  vector = vector_ensure(vector, 20);
+  vector = vector_excise_unordered(vector, 0, 3);
+  assert_vector_data(vector, 21);
+  assert(vector_volume(vector) < 20);
+
+  // It leaves the other reference to a shared vector as is
+  int *share = vector_share(vector);
+  share = vector_excise_unordered(share, 0, 1);
+  assert(vector_length(share) == 0);
+  assert_vector_data(vector, 21);
+
+  vector_delete(share);
+  vector_delete(vector);
+}
+
 int main() {
   test_vector_remove();
   test_vector_excise();
   test_vector_truncate();
+  test_vector_truncate_keep();
+  test_vector_clear();
+  test_vector_remove_if();
+  test_vector_remove_indices();
+  test_vector_remove_bitmap();
+  test_vector_remove_unordered();
+  test_vector_excise_unordered();
 }
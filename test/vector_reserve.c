@@ -0,0 +1,64 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int resize_errno = 0;
+static size_t resize_count = 0;
+vector_t vector_resize_z(vector_t vector, size_t volume, size_t z) {
+  resize_count++;
+  if (resize_errno != 0)
+    return errno = resize_errno, NULL;
+  return REAL(vector_resize_z)(vector, volume, z);
+}
+
+static size_t last_z;
+vector_t vector_reserve_z(vector_t vector, size_t length, size_t z) {
+  return REAL(vector_reserve_z)(vector, length, last_z = z);
+}
+
+int main() {
+  int *vector = vector_define(int, 1, 2, 3, 5);
+  int number = 0;
+
+  // It evaluates each argument once
+  vector = vector_reserve((number++, vector), 10);
+  assert(number == 1);
+  vector = vector_reserve(vector, (number++, 12));
+  assert(number == 2);
+
+  // It calls vector_reserve_z() with the element size of the vector
+  vector = vector_reserve(vector, 4);
+  assert(last_z == sizeof(vector[0]));
+
+  // Its expansion is an expression
+  assert((vector = vector_reserve(vector, 4)));
+
+  // With a length less than or equal to the vector's volume it returns the
+  // vector unmodified without a resize
+  resize_count = 0;
+  assert(vector_reserve(vector, vector_volume(vector)) == vector);
+  assert(resize_count == 0);
+
+  // With a length greater than the vector's volume it resizes the vector to
+  // exactly that length
+  vector = vector_reserve(vector, 1000);
+  assert(resize_count == 1);
+  assert(vector_volume(vector) == 1000);
+  assert(vector_length(vector) == 4);
+  assert_vector_data(vector, 1, 2, 3, 5);
+
+  // When the resize is unsuccessful it returns NULL with errno retained from
+  // the resize
+  resize_errno = ENOENT;
+  errno = 0;
+  assert(vector_reserve(vector, 2000) == NULL);
+  assert(errno == ENOENT);
+  resize_errno = 0;
+  assert(vector_volume(vector) == 1000);
+
+  vector_delete(vector);
+}
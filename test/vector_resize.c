@@ -19,6 +19,56 @@ vector_t vector_resize_z(vector_t vector, size_t volume, size_t z) {
   return REAL(vector_resize_z)(vector, volume, last_z = z);
 }
 
+void test_vector_resize_zeroed(void) {
+  size_t *vector = vector_create();
+
+  // When the vector has less to retain than to zero it moves it to a zeroed
+  // allocation without a reallocation
+  realloc_errno = ENOENT;
+  vector = vector_resize_zeroed(vector, 1 << 16);
+  realloc_errno = 0;
+  assert(vector != NULL);
+  assert(vector_length(vector) == 0);
+  assert(vector_volume(vector) == 1 << 16);
+  vector = vector_extend(vector, NULL, 1 << 16);
+  for (size_t i = 0; i < 1 << 16; i++)
+    assert(vector[i] == 0);
+  vector_delete(vector);
+
+  // It zeroes the elements beyond the length within the volume
+  vector = vector_define(size_t, 1, 2, 3, 4, 5, 6, 7, 8);
+  vector = vector_truncate(vector, 2);
+  vector = vector_reserve(vector, 8);
+  vector = vector_resize_zeroed(vector, 6);
+  assert(vector_length(vector) == 2);
+  assert(vector_volume(vector) == 6);
+  vector = vector_extend(vector, NULL, 4);
+  assert_vector_data(vector, 1, 2, 0, 0, 0, 0);
+
+  // It zeroes the elements of a reallocation
+  vector = vector_truncate(vector, 3);
+  vector = vector_resize_zeroed(vector, 8);
+  assert(vector_length(vector) == 3);
+  vector = vector_extend(vector, NULL, 5);
+  assert_vector_data(vector, 1, 2, 0, 0, 0, 0, 0, 0);
+
+  // With a volume less than the vector's length it truncates the vector
+  vector = vector_resize_zeroed(vector, 1);
+  assert_vector_data(vector, 1);
+  assert(vector_volume(vector) == 1);
+
+  // When the reallocation is unsuccessful it returns NULL with errno retained
+  // from realloc()
+  realloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_resize_zeroed(vector, 2) == NULL);
+  assert(errno == ENOENT);
+  realloc_errno = 0;
+  assert_vector_data(vector, 1);
+
+  vector_delete(vector);
+}
+
 int main() {
   int *vector = vector_define(int, 1, 2, 3, 4, 5, 6, 7, 8);
   int number = 0;
@@ -73,4 +123,6 @@ int main() {
   assert(vector_length(vector) == vector_volume(vector));
 
   vector_delete(vector);
+
+  test_vector_resize_zeroed();
 }
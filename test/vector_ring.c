@@ -0,0 +1,152 @@
+#include <assert.h>
+#include <errno.h>
+#include <stddef.h>
+#include <stdlib.h>
+
+#include <vector.h>
+#include "test.h"
+
+static int realloc_errno = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  if (realloc_errno != 0)
+    return errno = realloc_errno, NULL;
+  return realloc(data, size);
+}
+
+// Return the element at index i in the ring
+static int at(const struct vector_ring *ring, size_t i) {
+  return *(int *) vector_ring_at(ring, i);
+}
+
+void test_vector_ring_push(void) {
+  int *vector = vector_define(int, 1, 2, 3, 4);
+  struct vector_ring ring;
+  int data;
+
+  assert(vector_ring_begin(&ring, vector) == 0);
+  assert(vector_ring_length(&ring) == 4);
+
+  // It pushes and shifts elements without moving the others
+  vector = ring.vector;
+  vector_ring_shift(&ring, &data);
+  assert(data == 1);
+  vector_ring_shift(&ring, NULL);
+  assert(vector_ring_push(&ring, &(int) { 5 }) == 0);
+  assert(vector_ring_push(&ring, &(int) { 6 }) == 0);
+  assert(ring.vector == vector);
+  assert(ring.head == 2);
+  assert(at(&ring, 0) == 3 && at(&ring, 1) == 4);
+  assert(at(&ring, 2) == 5 && at(&ring, 3) == 6);
+
+  // It linearizes the elements that wrap around the end of the volume
+  vector = vector_ring_linearize(&ring);
+  assert_vector_data(vector, 3, 4, 5, 6);
+  assert(ring.head == 0);
+
+  // It grows the vector with the elements that wrap around it unwrapped
+  vector_ring_shift(&ring, NULL);
+  vector_ring_shift(&ring, NULL);
+  assert(vector_ring_push(&ring, &(int) { 7 }) == 0);
+  assert(vector_ring_push(&ring, &(int) { 8 }) == 0);
+  assert(ring.head == 2);
+  for (int i = 9; i < 100; i++)
+    assert(vector_ring_push(&ring, &i) == 0);
+  assert(vector_ring_length(&ring) == 95);
+  for (size_t i = 0; i < 95; i++)
+    assert(at(&ring, i) == 5 + (int) i);
+
+  // It pulls elements from the tail
+  vector_ring_pull(&ring, &data);
+  assert(data == 99);
+  assert(vector_ring_length(&ring) == 94);
+
+  vector = vector_ring_linearize(&ring);
+  assert(vector_length(vector) == 94);
+  for (size_t i = 0; i < 94; i++)
+    assert(vector[i] == 5 + (int) i);
+
+  vector_delete(vector);
+}
+
+void test_vector_ring_unshift(void) {
+  int *vector = vector_create();
+  struct vector_ring ring;
+  int data;
+
+  assert(vector_ring_begin(&ring, vector) == 0);
+
+  // It unshifts elements onto the empty vector
+  for (int i = 0; i < 10; i++)
+    assert(vector_ring_unshift(&ring, &i) == 0);
+  assert(vector_ring_length(&ring) == 10);
+  for (size_t i = 0; i < 10; i++)
+    assert(at(&ring, i) == 9 - (int) i);
+
+  // It's used as a queue with a steady length without growth
+  size_t volume = vector_volume(ring.vector);
+  for (int i = 10; i < 1000; i++) {
+    vector_ring_pull(&ring, &data);
+    assert(data == i - 10);
+    assert(vector_ring_unshift(&ring, &i) == 0);
+  }
+  assert(vector_volume(ring.vector) == volume);
+
+  // It linearizes the elements
+  vector = vector_ring_linearize(&ring);
+  assert(vector_length(vector) == 10);
+  for (size_t i = 0; i < 10; i++)
+    assert(vector[i] == 999 - (int) i);
+  assert(ring.head == 0);
+
+  // It continues to be used after it's linearized
+  vector_ring_shift(&ring, &data);
+  assert(data == 999);
+  assert(vector_ring_push(&ring, &(int) { 0 }) == 0);
+  vector = vector_ring_linearize(&ring);
+  assert(vector_length(vector) == 10);
+  assert(vector[0] == 998 && vector[8] == 990 && vector[9] == 0);
+
+  vector_delete(vector);
+}
+
+void test_vector_ring_fail(void) {
+  int *vector = vector_define(int, 1, 2);
+  struct vector_ring ring;
+
+  vector = vector_shrink(vector);
+  assert(vector_ring_begin(&ring, vector) == 0);
+  vector_ring_shift(&ring, NULL);
+  assert(vector_ring_push(&ring, &(int) { 3 }) == 0);
+
+  // When the growth fails it returns -1 with errno retained from realloc()
+  realloc_errno = ENOENT;
+  errno = 0;
+  assert(vector_ring_unshift(&ring, &(int) { 1 }) == -1);
+  assert(errno == ENOENT);
+  realloc_errno = 0;
+  assert(vector_ring_length(&ring) == 2);
+  assert(at(&ring, 0) == 2 && at(&ring, 1) == 3);
+
+  vector = vector_ring_linearize(&ring);
+  assert_vector_data(vector, 2, 3);
+  vector_delete(vector);
+
+  // It begins a vector that's shared by unsharing it
+  vector = vector_define(int, 1, 2);
+  int *share = vector_share(vector);
+  assert(vector_ring_begin(&ring, share) == 0);
+  assert(ring.vector != vector);
+  assert(vector_ring_unshift(&ring, &(int) { 0 }) == 0);
+  share = vector_ring_linearize(&ring);
+  assert_vector_data(share, 0, 1, 2);
+  assert_vector_data(vector, 1, 2);
+
+  vector_delete(share);
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_ring_push();
+  test_vector_ring_unshift();
+  test_vector_ring_fail();
+}
@@ -0,0 +1,201 @@
+#include <assert.h>
+#include <errno.h>
+#include <signal.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <vector.h>
+#include "test.h"
+
+static size_t malloc_count = 0;
+static int *malloc_errno = NULL;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  int e;
+  malloc_count++;
+  if (malloc_errno == NULL || (e = *malloc_errno++) == 0)
+    return malloc(size);
+  return errno = e, NULL;
+}
+
+static size_t free_count = 0;
+__attribute__((used)) void stub_free(void *data) {
+  free_count++;
+  free(data);
+}
+
+void test_vector_share(void) {
+  int *vector = vector_define(int, 1, 2, 3);
+  int *share;
+
+  // It returns the vector itself without an allocation
+  malloc_count = 0;
+  share = vector_share(vector);
+  assert(share == vector);
+  assert(malloc_count == 0);
+  assert(vector_shared(vector));
+
+  // It deallocates the vector once each reference is deleted
+  free_count = 0;
+  vector_delete(share);
+  assert(free_count == 0);
+  assert(!vector_shared(vector));
+  assert_vector_data(vector, 1, 2, 3);
+  vector_delete(vector);
+  assert(free_count == 1);
+
+  // When the vector is empty it returns it as is
+  vector = vector_create();
+  assert(vector_share(vector) == vector);
+  assert(!vector_shared(vector));
+  vector_delete(vector);
+
+  // When the vector is in storage that it doesn't own it duplicates it
+  _Alignas(max_align_t) char storage[256];
+  vector = vector_create_local(storage, sizeof(storage), sizeof(int));
+  vector = vector_append(vector, &(int) { 1 });
+  malloc_count = 0;
+  share = vector_share(vector);
+  assert(share != vector);
+  assert(malloc_count == 1);
+  assert_vector_data(share, 1);
+  vector_delete(share);
+  vector_delete(vector);
+}
+
+void test_vector_unshare(void) {
+  int *vector = vector_define(int, 1, 2, 3);
+  int *share;
+
+  // When the vector isn't shared it returns it as is
+  malloc_count = 0;
+  assert(vector_unshare(vector) == vector);
+  assert(malloc_count == 0);
+
+  // It duplicates the vector and leaves the other reference as is
+  share = vector_share(vector);
+  share = vector_unshare(share);
+  assert(share != vector);
+  assert(!vector_shared(vector));
+  share[0] = 4;
+  assert_vector_data(vector, 1, 2, 3);
+  assert_vector_data(share, 4, 2, 3);
+  vector_delete(share);
+
+  // When the duplicate fails it leaves the vector shared
+  share = vector_share(vector);
+  malloc_errno = (int[]) { ENOMEM, ENOMEM };
+  errno = 0;
+  assert(vector_unshare(share) == NULL);
+  assert(errno == ENOMEM);
+  malloc_errno = NULL;
+  assert(vector_shared(vector));
+
+  vector_delete(share);
+  vector_delete(vector);
+}
+
+void test_vector_share_modify(void) {
+  int *vector = vector_define(int, 1, 2, 3);
+  int *share;
+
+  // It unshares the vector on an insertion
+  share = vector_share(vector);
+  share = vector_append(share, &(int) { 4 });
+  assert(share != vector);
+  assert_vector_data(vector, 1, 2, 3);
+  assert_vector_data(share, 1, 2, 3, 4);
+  vector_delete(share);
+
+  // It unshares the vector on a removal
+  share = vector_share(vector);
+  share = vector_remove(share, 0);
+  assert(share != vector);
+  assert_vector_data(vector, 1, 2, 3);
+  assert_vector_data(share, 2, 3);
+  vector_delete(share);
+
+  // It unshares the vector on a resize
+  share = vector_share(vector);
+  share = vector_resize(share, 1);
+  assert(share != vector);
+  assert_vector_data(vector, 1, 2, 3);
+  assert_vector_data(share, 1);
+  vector_delete(share);
+
+  // When the unshare fails the removal fails with the vector unmodified
+  share = vector_share(vector);
+  malloc_errno = (int[]) { ENOMEM, ENOMEM };
+  errno = 0;
+  assert(vector_truncate(share, 0) == NULL);
+  assert(errno == ENOMEM);
+  malloc_errno = NULL;
+  assert_vector_data(share, 1, 2, 3);
+
+  // When the growth fails the insertion fails with the vector still shared
+  vector_delete(share);
+  share = vector_share(vector);
+  malloc_errno = (int[]) { ENOMEM, ENOMEM, ENOMEM, ENOMEM };
+  errno = 0;
+  assert(vector_append(share, &(int) { 4 }) == NULL);
+  assert(vector_unshift(share, &(int) { 0 }) == NULL);
+  assert(errno == ENOMEM);
+  malloc_errno = NULL;
+  assert(vector_shared(vector));
+  assert_vector_data(share, 1, 2, 3);
+
+  // When the other references are deleted it modifies the vector in place
+  vector_delete(vector);
+  share = vector_remove(share, 0);
+  assert_vector_data(share, 2, 3);
+  vector_delete(share);
+}
+
+// Return whether the modification aborts in a child process
+#define aborts(modification) ({ \
+  pid_t __pid = fork(); \
+  assert(__pid >= 0); \
+  if (__pid == 0) { \
+    close(STDERR_FILENO); \
+    modification; \
+    _exit(0); \
+  } \
+  int __status; \
+  assert(waitpid(__pid, &__status, 0) == __pid); \
+  WIFSIGNALED(__status) && WTERMSIG(__status) == SIGABRT; \
+})
+
+static int int_cmp(const void *a, const void *b) {
+  return *(const int *) a - *(const int *) b;
+}
+
+void test_vector_share_in_place(void) {
+  int *vector = vector_import(((int[]) { 3, 1, 2 }), 3);
+  int *share = vector_share(vector);
+
+  // It asserts that a vector modified in place isn't shared
+  assert(aborts(vector_set(share, 0, &(int) { 4 }, sizeof(int))));
+  assert(aborts(vector_swap(share, 0, 1)));
+  assert(aborts(vector_move(share, 0, 2)));
+  assert(aborts(vector_sort(share, int_cmp)));
+  assert_vector_data(vector, 3, 1, 2);
+
+  // It modifies the vector in place once it's unshared
+  share = vector_unshare(share);
+  vector_set(share, 0, &(int) { 4 }, sizeof(int));
+  vector_sort(share, int_cmp);
+  assert_vector_data(share, 1, 2, 4);
+  assert_vector_data(vector, 3, 1, 2);
+
+  vector_delete(share);
+  vector_delete(vector);
+}
+
+int main() {
+  test_vector_share();
+  test_vector_unshare();
+  test_vector_share_modify();
+  test_vector_share_in_place();
+}
@@ -1,10 +1,30 @@
 #include <assert.h>
+#include <errno.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <stdlib.h>
 
 #include <vector.h>
 #include "test.h"
 
+static int malloc_errno = 0;
+static size_t malloc_count = 0;
+__attribute__((used)) void *stub_malloc(size_t size) {
+  malloc_count++;
+  if (malloc_errno != 0)
+    return errno = malloc_errno, NULL;
+  return malloc(size);
+}
+
+static int realloc_errno = 0;
+static size_t realloc_count = 0;
+__attribute__((used)) void *stub_realloc(void *data, size_t size) {
+  realloc_count++;
+  if (realloc_errno != 0)
+    return errno = realloc_errno, NULL;
+  return realloc(data, size);
+}
+
 // vector_pull(), vector_pull_z()
 
 static size_t last_pull_z;
@@ -92,7 +112,12 @@ void test_vector_unshift(void) {
   // Its expansion is an expression
   assert((vector = vector_unshift(vector, NULL)));
 
-  // It delegates to vector_insert_z() with 0 and the element size of the vector
+  vector_delete(vector);
+  vector = vector_define_local(int, 16);
+  vector = vector_extend(vector, ((int[]) { 2, 3, 5, 8 }), 4);
+
+  // When the vector is in storage that has the volume for the element it
+  // delegates to vector_insert_z() with 0 and the element size of the vector
   int *result = vector_unshift(vector, &data);
   assert(last_vector == vector);
   assert(last_i == 0);
@@ -149,10 +174,164 @@ void test_vector_shift(void) {
   vector_delete(vector);
 }
 
+// vector_shift(), vector_unshift() with headroom
+
+struct pair {
+  _Alignas(max_align_t) long long first;
+};
+
+void test_vector_shift_headroom(void) {
+  struct pair *vector = vector_create();
+  struct pair *before;
+  struct pair data;
+
+  for (long long i = 1; i <= 8; i++)
+    vector = vector_append(vector, &(struct pair) { i });
+
+  // It unshifts an element into the headroom without moving the others
+  vector = vector_unshift(vector, &(struct pair) { 0 });
+  before = vector;
+  vector = vector_unshift(vector, &(struct pair) { -1 });
+  assert(vector + 1 == before);
+  assert(vector_length(vector) == 10);
+  assert(vector[0].first == -1 && vector[1].first == 0);
+  assert(vector[2].first == 1 && vector[9].first == 8);
+
+  // It shifts an element by advancing the start of the vector
+  before = vector;
+  vector = vector_shift(vector, &data);
+  assert(vector == before + 1);
+  assert(data.first == -1);
+  assert(vector_length(vector) == 9);
+  assert(vector[0].first == 0 && vector[8].first == 8);
+
+  // It regrows the headroom once it's used, with the elements contiguous
+  for (long long i = 1; i <= 100; i++)
+    assert((vector = vector_unshift(vector, &(struct pair) { -i })));
+  assert(vector_length(vector) == 109);
+  for (size_t i = 0; i < 109; i++)
+    assert(vector[i].first == (long long) i - 100);
+
+  // It retains the elements as it's used as a queue
+  for (long long i = 9; i < 1009; i++) {
+    assert((vector = vector_append(vector, &(struct pair) { i })));
+    assert((vector = vector_shift(vector, &data)));
+    assert(data.first == i - 109);
+  }
+  assert(vector_length(vector) == 109);
+  for (size_t i = 0; i < 109; i++)
+    assert(vector[i].first == 900 + (long long) i);
+
+  // It reduces the volume, with the headroom, as the vector is drained
+  while (vector_length(vector) > 1)
+    vector = vector_shift(vector, NULL);
+  assert(vector_volume(vector) < 10);
+  assert(vector[0].first == 1008);
+
+  // When the allocation fails it returns NULL with the vector unmodified
+  vector = vector_shrink(vector);
+  malloc_errno = ENOMEM;
+  errno = 0;
+  assert(vector_unshift(vector, &(struct pair) { 0 }) == NULL);
+  assert(errno == ENOMEM);
+  malloc_errno = 0;
+  assert(vector_length(vector) == 1 && vector[0].first == 1008);
+
+  // When the vector is shared it leaves the other reference as is
+  vector = vector_unshift(vector, &(struct pair) { 1007 });
+  struct pair *share = vector_share(vector);
+  share = vector_shift(share, NULL);
+  assert(vector_length(share) == 1 && share[0].first == 1008);
+  assert(vector_length(vector) == 2 && vector[0].first == 1007);
+  vector_delete(share);
+
+  vector_delete(vector);
+
+  // When the element size isn't a multiple of the alignment it moves the
+  // elements
+  vector = vector_create_aligned(2 * sizeof(struct pair));
+  vector = vector_unshift(vector, &(struct pair) { 2 });
+  vector = vector_unshift(vector, &(struct pair) { 1 });
+  vector = vector_shift(vector, &data);
+  assert(data.first == 1);
+  assert(vector_length(vector) == 1 && vector[0].first == 2);
+  assert((size_t) vector % (2 * sizeof(struct pair)) == 0);
+  vector_delete(vector);
+}
+
+// vector_shift(), vector_unshift() with elements smaller than the alignment
+
+void test_vector_shift_skew(void) {
+  int *vector = vector_create();
+  int *before;
+  int data;
+
+  for (int i = 0; i < 64; i++)
+    vector = vector_append(vector, &i);
+
+  // It shifts an element by advancing the start of the vector, without moving
+  // the others
+  malloc_count = realloc_count = 0;
+  for (int i = 0; i < 20; i++) {
+    before = vector;
+    vector = vector_shift(vector, &data);
+    assert(vector == before + 1);
+    assert(data == i);
+  }
+  assert(vector_length(vector) == 44);
+  assert(vector[0] == 20 && vector[43] == 63);
+
+  // It unshifts an element into the headroom that the shifts leave
+  for (int i = 19; i >= 0; i--) {
+    before = vector;
+    vector = vector_unshift(vector, &i);
+    assert(vector == before - 1);
+  }
+  assert(malloc_count == 0 && realloc_count == 0);
+  assert((uintptr_t) vector % _Alignof(max_align_t) == 0);
+  assert(vector_length(vector) == 64);
+  for (int i = 0; i < 64; i++)
+    assert(vector[i] == i);
+
+  // It retains the elements as it's used as a queue
+  for (int i = 64; i < 10064; i++) {
+    assert((vector = vector_append(vector, &i)));
+    assert((vector = vector_shift(vector, &data)));
+    assert(data == i - 64);
+  }
+  assert(vector_length(vector) == 64);
+  for (int i = 0; i < 64; i++)
+    assert(vector[i] == 10000 + i);
+
+  // When a reallocation fails it leaves the shifted vector unmodified
+  vector = vector_shrink(vector);
+  vector = vector_shift(vector, NULL);
+  assert((uintptr_t) vector % _Alignof(max_align_t) != 0);
+  realloc_errno = ENOMEM;
+  errno = 0;
+  assert(vector_resize(vector, 1000) == NULL);
+  assert(errno == ENOMEM);
+  realloc_errno = 0;
+  assert(vector_length(vector) == 63);
+  for (int i = 0; i < 63; i++)
+    assert(vector[i] == 10001 + i);
+
+  // It moves the elements back to the start on a reallocation
+  vector = vector_resize(vector, 1000);
+  assert((uintptr_t) vector % _Alignof(max_align_t) == 0);
+  assert(vector_length(vector) == 63 && vector_volume(vector) == 1000);
+  for (int i = 0; i < 63; i++)
+    assert(vector[i] == 10001 + i);
+
+  vector_delete(vector);
+}
+
 int main() {
   assert(!strcmp(DEFINITION_SOURCE(vector_push), "vector_append"));
   assert(!strcmp(DEFINITION_SOURCE(vector_push_z), "vector_append_z"));
   test_vector_pull();
   test_vector_unshift();
   test_vector_shift();
+  test_vector_shift_headroom();
+  test_vector_shift_skew();
 }